@@ -18,6 +18,12 @@ class GetPropertyCodeGen : public kodgen::MacroPropertyCodeGen
 			kodgen::MacroPropertyCodeGen("Get", kodgen::EEntityType::Field)
 		{}
 
+		virtual bool usesPropertyDispatchIndex() const noexcept override
+		{
+			//shouldGenerateCodeForEntity is not overridden, so only the entities carrying this property are relevant
+			return true;
+		}
+
 		virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& /* entity */, kodgen::Property const& property, kodgen::uint8 /* propertyIndex */, kodgen::MacroCodeGenEnv& env) noexcept override
 		{
 			std::string errorMessage;
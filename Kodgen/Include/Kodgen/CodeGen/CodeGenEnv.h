@@ -8,6 +8,7 @@
 #pragma once
 
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+#include "Kodgen/InfoStructures/ProjectStructClassTree.h"
 #include "Kodgen/Misc/ILogger.h"
 
 namespace kodgen
@@ -27,6 +28,9 @@ namespace kodgen
 
 			/** Logger used to log during the code generation process. Can be nullptr. */
 			ILogger*					_logger				= nullptr;
+
+			/** Inheritance hierarchy of all the files parsed by the CodeGenManager. Can be nullptr. */
+			ProjectStructClassTree const*	_projectStructClassTree	= nullptr;
 		
 		public:
 			virtual ~CodeGenEnv() = default;
@@ -44,6 +48,15 @@ namespace kodgen
 			*	@return _logger.
 			*/
 			inline ILogger*					getLogger()				const	noexcept;
+
+			/**
+			*	@brief	Getter for the _projectStructClassTree field.
+			*			Unlike the StructClassTree of the file parsing result, it also contains the inheritance links found in all the other parsed files.
+			*			Files which are still being parsed when the code is generated are not included yet.
+			* 
+			*	@return _projectStructClassTree.
+			*/
+			inline ProjectStructClassTree const*	getProjectStructClassTree()	const	noexcept;
 	};
 
 	#include "Kodgen/CodeGen/CodeGenEnv.inl"
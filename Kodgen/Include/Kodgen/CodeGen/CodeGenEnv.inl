@@ -13,4 +13,9 @@ inline FileParsingResult const* CodeGenEnv::getFileParsingResult() const noexcep
 inline ILogger* CodeGenEnv::getLogger() const noexcept
 {
 	return _logger;
+}
+
+inline ProjectStructClassTree const* CodeGenEnv::getProjectStructClassTree() const noexcept
+{
+	return _projectStructClassTree;
 }
\ No newline at end of file
@@ -8,15 +8,26 @@
 #pragma once
 
 #include <set>
+#include <vector>
+#include <mutex>
 #include <cassert>
 #include <type_traits>	//std::is_base_of
-#include <chrono>		//std::chrono::high_resolution_clock
+#include <chrono>		//std::chrono::high_resolution_clock, std::chrono::milliseconds
+#include <functional>	//std::function
+#include <thread>		//std::this_thread::sleep_for
+#include <string_view>
 
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/StringTable.h"
 #include "Kodgen/CodeGen/CodeGenResult.h"
 #include "Kodgen/CodeGen/CodeGenUnit.h"
 #include <Kodgen/CodeGen/CodeGenManagerSettings.h>
+#include "Kodgen/CodeGen/GenerationManifest.h"
+#include "Kodgen/CodeGen/ParsingResultCache.h"
+#include "Kodgen/CodeGen/ShardWorkerProcess.h"
+#include "Kodgen/InfoStructures/ProjectStructClassTree.h"
 #include "Kodgen/Parsing/FileParser.h"
+#include "Kodgen/Parsing/TranslationUnitCache.h"
 #include "Kodgen/Threading/ThreadPool.h"
 #include "Kodgen/Threading/TaskHelper.h"
 
@@ -26,12 +37,80 @@ namespace kodgen
 	{
 		private:
 			/** Thread pool used for files processing. */
-			ThreadPool	_threadPool;
+			ThreadPool				_threadPool;
+
+			/** Manifest used to check whether files are up-to-date when settings.shouldUseGenerationManifest is true. */
+			GenerationManifest		_generationManifest;
+
+			/** Cache of the parsing results used when settings.shouldCacheParsingResults is true. */
+			ParsingResultCache		_parsingResultCache;
+
+			/** Inheritance hierarchy merged from all the files parsed by this manager, updated as soon as each file is parsed. */
+			ProjectStructClassTree	_projectStructClassTree;
+
+			/**
+			*	Is this manager the copy of a worker process (see processFilesInWorkerProcesses)?
+			*	The threads of _threadPool don't exist in worker processes, so _threadPool must never be used when this is true.
+			*/
+			bool					_isWorkerProcess	= false;
+
+			struct DirectoryScanContext
+			{
+				/** Generation unit used to determine whether a file should be reparsed/regenerated or not. */
+				CodeGenUnit const&		codeGenUnit;
+
+				/** Should all files be regenerated or not. */
+				bool					forceRegenerateAll;
+
+				/** Filter of the ignored files and directories. */
+				PathFilter const&		ignoredPathFilter;
+
+				/** Mutex protecting scannedDirectories, toProcessFiles and upToDateFiles. */
+				std::mutex				mutex;
+
+				/**
+				*	Canonical paths of the directories already submitted for scanning.
+				*	Directory symlinks are followed, so a directory can be reached several times, or endlessly through a symlink to an ancestor.
+				*/
+				std::set<fs::path>		scannedDirectories;
+
+				/** Files to process found by all the directory scan tasks. */
+				std::set<fs::path>&		toProcessFiles;
+
+				/** Up-to-date files found by all the directory scan tasks. */
+				std::vector<fs::path>&	upToDateFiles;
+			};
+
+			/**
+			*	@brief	Parse a file, reusing its cached parsing result if settings.shouldCacheParsingResults is true.
+			*			If the file is parsed successfully, its inheritance links are published to the project struct/class tree.
+			*			A cached parsing result still triggers the fileParser preParse and postParse hooks.
+			*
+			*	@param fileParser	Parser used to parse the file.
+			*	@param file			Path to the file to parse.
+			*
+			*	@return The parsing result of the file.
+			*/
+			template <typename FileParserType>
+			FileParsingResult	parseFile(FileParserType&	fileParser,
+										  fs::path const&	file)												noexcept;
+
+			/**
+			*	@brief Generate the code of a parsed file with a fresh copy of the provided generation unit.
+			*
+			*	@param codeGenUnit		Generation unit model.
+			*	@param parsingResult	Parsing result of the file.
+			*
+			*	@return true if the file was parsed without errors and its code was generated successfully, else false.
+			*/
+			template <typename CodeGenUnitType>
+			bool				generateFile(CodeGenUnitType const&		codeGenUnit,
+											 FileParsingResult const&	parsingResult)								noexcept;
 
 			/**
 			*	@brief Process all provided files on multiple threads.
 			*	
-			*	@param fileParser		Original file parser to use to parse registered files. A copy of this parser will be used for each generation thread.
+			*	@param fileParser		Original file parser to use to parse registered files. A copy of this parser is made for each worker thread and reused for all the files it parses.
 			*	@param codeGenUnit		Generation unit used to generate files. It must have a clean state when this method is called.
 			*	@param toProcessFiles	Collection of all files to process.
 			*	@param out_genResult	Reference to the generation result to fill during file generation.
@@ -43,7 +122,86 @@ namespace kodgen
 								 CodeGenResult&				out_genResult)										noexcept;
 
 			/**
-			*	@brief Identify all files which will be parsed & regenerated.
+			*	@brief	Split the provided files across settings.workerProcessCount worker processes, and merge their results.
+			*			Files which can't be sent to a worker process are processed by the current process.
+			*	
+			*	@param fileParser		Original file parser to use to parse registered files. Each worker process uses its own copy.
+			*	@param codeGenUnit		Generation unit used to generate files. It must have a clean state when this method is called.
+			*	@param toProcessFiles	Collection of all files to process.
+			*	@param out_genResult	Reference to the generation result to fill during file generation.
+			*/
+			template <typename FileParserType, typename CodeGenUnitType>
+			void	processFilesInWorkerProcesses(FileParserType&			fileParser,
+												  CodeGenUnitType&			codeGenUnit,
+												  std::set<fs::path> const&	toProcessFiles,
+												  CodeGenResult&			out_genResult)						noexcept;
+
+			/**
+			*	@brief	Process a shard of the files in a worker process, sending the result of each file to the main process.
+			*			All the iterations of all the files are processed sequentially on the calling thread.
+			*	
+			*	@param fileParser	Original file parser, copied to parse the files.
+			*	@param codeGenUnit	Generation unit used to generate files.
+			*	@param files		Files of the shard.
+			*	@param channel		Channel used to send messages to the main process.
+			*
+			*	@return true if all the files were generated successfully and all their results were sent, else false.
+			*/
+			template <typename FileParserType, typename CodeGenUnitType>
+			bool	processShardFiles(FileParserType&				fileParser,
+									  CodeGenUnitType&				codeGenUnit,
+									  std::vector<fs::path> const&	files,
+									  int							channel)									noexcept;
+
+			/**
+			*	@brief	Split files in shards. The shard of a file only depends on its path and on the shard count,
+			*			so a file is always processed by the same worker as long as the shard count doesn't change.
+			*	
+			*	@param files		Files to split.
+			*	@param shardCount	Number of shards, greater than 0.
+			*
+			*	@return The files of each shard.
+			*/
+			std::vector<std::vector<fs::path>>	shardFiles(std::set<fs::path> const&	files,
+														   uint32						shardCount)		const	noexcept;
+
+			/**
+			*	@brief Check whether the files should be processed by worker processes, logging why not if sharding is requested but not possible.
+			*	
+			*	@param codeGenUnit Generation unit used to generate files.
+			*
+			*	@return true if settings.workerProcessCount worker processes should be used, else false.
+			*/
+			bool					shouldUseWorkerProcesses(CodeGenUnit const& codeGenUnit)			const	noexcept;
+
+			/**
+			*	@brief	Send the result of a file processed by a worker process to the main process.
+			*			Only the data the main process needs to update the generation manifest and the project struct/class tree is sent.
+			*	
+			*	@param channel			Channel used to send messages to the main process.
+			*	@param file				Path to the processed file.
+			*	@param parsingResult	Parsing result of the file.
+			*	@param completed		Was the code of the file generated successfully?
+			*
+			*	@return true if the result was sent, else false.
+			*/
+			bool					sendShardFileResult(int							channel,
+														fs::path const&				file,
+														FileParsingResult const&	parsingResult,
+														bool						completed)			const	noexcept;
+
+			/**
+			*	@brief Apply the result of a file received from a worker process to the generation manifest and the project struct/class tree.
+			*	
+			*	@param message			Message sent by sendShardFileResult.
+			*	@param out_genResult	Generation result, marked as not completed if the message is invalid.
+			*/
+			void					applyShardFileResult(std::string_view	message,
+														 CodeGenResult&		out_genResult)						noexcept;
+
+			/**
+			*	@brief	Identify all files which will be parsed & regenerated.
+			*			The toProcessDirectories are scanned in parallel on the thread pool, one task per directory.
 			*	
 			*	@param codeGenUnit			Generation unit used to determine whether a file should be reparsed/regenerated or not.
 			*	@param out_genResult		Reference to the generation result to fill during file generation.
@@ -55,6 +213,86 @@ namespace kodgen
 														   CodeGenResult&		out_genResult,
 														   bool					forceRegenerateAll)				noexcept;
 
+			/**
+			*	@brief	Submit a task to the thread pool scanning the files of a directory, unless the directory has already been submitted.
+			*			A new task is submitted for each non-ignored subdirectory, so the whole directory tree is scanned in parallel.
+			* 
+			*	@param directory	Canonical path of the directory to scan.
+			*	@param context		Scan state shared by all the directory scan tasks. It must outlive the tasks.
+			*/
+			void					submitDirectoryScanTask(fs::path				directory,
+															DirectoryScanContext&	context)							noexcept;
+
+			/**
+			*	@brief	Scan the files of a directory (non-recursively) and submit a scan task for each non-ignored subdirectory.
+			*			Files found in the directory are added to the context in a single batch.
+			* 
+			*	@param directory	Directory to scan.
+			*	@param context		Scan state shared by all the directory scan tasks.
+			*/
+			void					scanDirectory(fs::path const&		directory,
+												  DirectoryScanContext&	context)								noexcept;
+
+			/**
+			*	@brief	Check whether the code generated for a file is up-to-date, using the generation manifest
+			*			if settings.shouldUseGenerationManifest is true, else the code generation unit.
+			*			With the manifest, the files generated for the file must exist as well (see CodeGenUnit::hasGeneratedFiles).
+			* 
+			*	@param codeGenUnit	Generation unit used to generate the file.
+			*	@param file			Path to the file to check.
+			* 
+			*	@return true if the file is up-to-date, else false.
+			*/
+			bool					isUpToDate(CodeGenUnit const&	codeGenUnit,
+											   fs::path const&		file)									noexcept;
+
+			/**
+			*	@brief	Compute a hash of all the settings affecting the parsing results, used to invalidate the parsing result cache.
+			*			It includes the effective compilation arguments, so the parsing settings must have been initialized.
+			* 
+			*	@param parsingSettings Parsing settings.
+			* 
+			*	@return The parsing settings hash.
+			*/
+			uint64					computeParsingSettingsHash(ParsingSettings const& parsingSettings)	const	noexcept;
+
+			/**
+			*	@brief Compute a hash of all the settings affecting the generated code, used to invalidate the generation manifest.
+			* 
+			*	@param parsingSettings	Parsing settings.
+			*	@param codeGenUnit		Generation unit used to generate code.
+			* 
+			*	@return The settings hash.
+			*/
+			uint64					computeSettingsHash(ParsingSettings const&	parsingSettings,
+														CodeGenUnit const&		codeGenUnit)			const	noexcept;
+
+			/**
+			*	@brief Load the generation manifest from the output directory of the provided code generation unit.
+			* 
+			*	@param parsingSettings	Parsing settings.
+			*	@param codeGenUnit		Generation unit used to generate code.
+			*/
+			void					loadGenerationManifest(ParsingSettings const&	parsingSettings,
+														   CodeGenUnit const&		codeGenUnit)				noexcept;
+
+			/**
+			*	@brief	Prepare the parsing result cache located in the output directory of the provided code generation unit.
+			*			Must be called before each generation pass.
+			* 
+			*	@param parsingSettings	Parsing settings.
+			*	@param codeGenUnit		Generation unit used to generate code.
+			*/
+			void					setupParsingResultCache(ParsingSettings const&	parsingSettings,
+															CodeGenUnit const&		codeGenUnit)				noexcept;
+
+			/**
+			*	@brief Save the generation manifest to the output directory of the provided code generation unit.
+			* 
+			*	@param codeGenUnit Generation unit used to generate code.
+			*/
+			void					saveGenerationManifest(CodeGenUnit const& codeGenUnit)				const	noexcept;
+
 			/**
 			*	@brief	Get the number of threads to use based on the provided thread count.
 			*			If 0 is provided, std::thread::hardware_concurrency is used, or 8 if std::thread::hardware_concurrency returns 0.
@@ -102,9 +340,18 @@ namespace kodgen
 			*/
 			CodeGenManager(uint32 threadCount = 0u)	noexcept;
 
+			/**
+			*	@brief	Getter for the _projectStructClassTree field.
+			*			It contains the inheritance links of every file successfully parsed by this manager, including files parsed by previous runs.
+			*
+			*	@return _projectStructClassTree.
+			*/
+			ProjectStructClassTree const&	getProjectStructClassTree()	const	noexcept;
+
 			/**
 			*	@brief	Parse registered files if they were modified since last generation (or don't exist)
 			*			and forward them to individual file generation unit for code generation.
+			*			Files are split across worker processes if settings.workerProcessCount is greater than 1.
 			*
 			*	@param fileParser			Original file parser to use to parse registered files. A copy of this parser will be used for each generation thread.
 			*	@param codeGenUnit			Generation unit used to generate code. It must have a clean state when this method is called.
@@ -116,6 +363,27 @@ namespace kodgen
 			CodeGenResult run(FileParserType&	fileParser,
 							  CodeGenUnitType&	codeGenUnit,
 							  bool				forceRegenerateAll	= false)	noexcept;
+
+			/**
+			*	@brief	Run an initial generation, then keep polling registered files and only parse / regenerate the modified ones.
+			*			Parsing settings are initialized (compiler probing, prefix header precompilation) only once, and translation units
+			*			are kept alive between generation passes so that they are reparsed incrementally.
+			*			Files which failed to generate are processed again on each pass until they succeed.
+			*
+			*	@param fileParser			Original file parser to use to parse registered files. A copy of this parser is made for each worker thread.
+			*	@param codeGenUnit			Generation unit used to generate code. It must have a clean state when this method is called.
+			*	@param shouldKeepWatching	Function called with the result of each generation pass. Returning false stops watching.
+			*	@param pollingPeriod		Time to wait between 2 generation passes.
+			*	@param forceRegenerateAll	Ignore the last write time check and reparse / regenerate all files during the initial generation.
+			*
+			*	@return Structure containing the report of the last generation pass.
+			*/
+			template <typename FileParserType, typename CodeGenUnitType>
+			CodeGenResult watch(FileParserType&										fileParser,
+								CodeGenUnitType&									codeGenUnit,
+								std::function<bool(CodeGenResult const&)> const&	shouldKeepWatching,
+								std::chrono::milliseconds							pollingPeriod		= std::chrono::milliseconds(100),
+								bool												forceRegenerateAll	= false)	noexcept;
 	};
 
 	#include "Kodgen/CodeGen/CodeGenManager.inl"
@@ -5,77 +5,300 @@
 *	See the LICENSE.md file for full license details.
 */
 
+template <typename FileParserType>
+FileParsingResult CodeGenManager::parseFile(FileParserType& fileParser, fs::path const& file) noexcept
+{
+	FileParsingResult parsingResult;
+
+	if (settings.shouldCacheParsingResults)
+	{
+		ParsingResultCache::EntryKey	key;
+		bool							isKeyComputed = _parsingResultCache.computeKey(file, fileParser.getSettings().getCompilationArguments(file), key);
+
+		//Skip parsing entirely if none of the file parsing inputs changed since it was cached
+		if (isKeyComputed && _parsingResultCache.load(file, key, parsingResult))
+		{
+			//Still run the parser hooks as if the file was parsed, so that parser overrides see every file
+			//Called through the base class since overrides may be declared protected in FileParserType
+			FileParser& baseFileParser = fileParser;
+
+			baseFileParser.preParse(file);
+			baseFileParser.postParse(file, parsingResult);
+		}
+		else
+		{
+			parsingResult = FileParsingResult();
+
+			//The key computed before parsing is stored, so that a file edited during the parsing is parsed again next time
+			if (fileParser.parse(file, parsingResult) && parsingResult.errors.empty() && isKeyComputed)
+			{
+				_parsingResultCache.store(file, key, parsingResult);
+			}
+		}
+	}
+	else
+	{
+		fileParser.parse(file, parsingResult);
+	}
+
+	//Publish the inheritance links of the file right away, so that other files generation can use them
+	if (parsingResult.errors.empty())
+	{
+		_projectStructClassTree.updateFile(file, parsingResult.structClassTree);
+	}
+
+	return parsingResult;
+}
+
+template <typename CodeGenUnitType>
+bool CodeGenManager::generateFile(CodeGenUnitType const& codeGenUnit, FileParsingResult const& parsingResult) noexcept
+{
+	//Generate the file only if no errors occured during parsing
+	if (!parsingResult.errors.empty())
+	{
+		return false;
+	}
+
+	//Copy the generation unit model to have a fresh one for this generation unit
+	CodeGenUnitType generationUnit = codeGenUnit;
+
+	generationUnit.projectStructClassTree				= &_projectStructClassTree;
+	generationUnit.shouldKeepIdenticalGeneratedFiles	= settings.shouldUseGenerationManifest;
+
+	return generationUnit.generateCode(parsingResult);
+}
+
 template <typename FileParserType, typename CodeGenUnitType>
 void CodeGenManager::processFiles(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, std::set<fs::path> const& toProcessFiles, CodeGenResult& out_genResult) noexcept
 {
+	//Worker processes don't have the thread pool threads
+	assert(!_isWorkerProcess);
+
 	std::vector<std::shared_ptr<TaskBase>>	generationTasks;
 	uint8									iterationCount = codeGenUnit.getIterationCount();
 
 	//Reserve enough space for all tasks
 	generationTasks.reserve(toProcessFiles.size() * iterationCount);
 
-	//Launch all parsing -> generation processes
-	std::shared_ptr<TaskBase> parsingTask;
-	
-	for (int i = 0; i < iterationCount; i++)
+	//Copy a parser for each worker, reused for all the parsing tasks the worker executes (and so is its libclang index)
+	std::vector<FileParserType> workerFileParsers(_threadPool.getWorkerCount(), fileParser);
+
+	if (settings.shouldCacheParsingResults)
 	{
-		//Lock the thread pool until all tasks have been pushed to avoid competing for the tasks mutex
-		_threadPool.setIsRunning(false);
+		setupParsingResultCache(fileParser.getSettings(), codeGenUnit);
+	}
 
-		for (fs::path const& file : toProcessFiles)
+	//Submit the parsing -> generation tasks of a file for a single iteration
+	auto submitFileTasks = [this, &workerFileParsers, &codeGenUnit, &out_genResult](fs::path const& file, int iteration, std::vector<std::shared_ptr<TaskBase>>&& deps) -> std::shared_ptr<TaskBase>
+	{
+		auto parsingTaskLambda = [this, &workerFileParsers, &file](TaskBase*) -> FileParsingResult
 		{
-			auto parsingTaskLambda = [&fileParser, &file](TaskBase*) -> FileParsingResult
-			{
-				//Copy a parser for this task
-				FileParserType		fileParserCopy = fileParser;
-				FileParsingResult	parsingResult;
+			//Use the parser of the worker executing this task
+			return parseFile(workerFileParsers[_threadPool.getCurrentWorkerIndex()], file);
+		};
+
+		auto generationTaskLambda = [this, &codeGenUnit, &file](TaskBase* parsingTask) -> CodeGenResult
+		{
+			CodeGenResult out_generationResult;
 
-				fileParserCopy.parse(file, parsingResult);
+			//Get the result of the parsing task
+			FileParsingResult parsingResult = TaskHelper::getDependencyResult<FileParsingResult>(parsingTask, 0u);
 
-				return parsingResult;
-			};
+			out_generationResult.completed = generateFile(codeGenUnit, parsingResult);
 
-			auto generationTaskLambda = [&codeGenUnit](TaskBase* parsingTask) -> CodeGenResult
+			if (settings.shouldUseGenerationManifest)
 			{
-				CodeGenResult out_generationResult;
+				if (out_generationResult.completed)
+				{
+					_generationManifest.updateSourceFile(file, parsingResult.includedFiles);
+				}
+				else
+				{
+					//Make sure the file is processed again on next generation
+					_generationManifest.removeSourceFile(file);
+				}
+			}
 
-				//Copy the generation unit model to have a fresh one for this generation unit
-				CodeGenUnitType	generationUnit = codeGenUnit;
+			return out_generationResult;
+		};
 
-				//Get the result of the parsing task
-				FileParsingResult parsingResult = TaskHelper::getDependencyResult<FileParsingResult>(parsingTask, 0u);
+		//Add file to the list of parsed files before starting the task to avoid having to synchronize threads
+		out_genResult.parsedFiles.push_back(file);
 
-				//Generate the file if no errors occured during parsing
-				if (parsingResult.errors.empty())
-				{
-					out_generationResult.completed = generationUnit.generateCode(parsingResult);
-				}
+		//Parse files
+		std::shared_ptr<TaskBase> parsingTask = _threadPool.submitTask(std::string("Parsing ") + std::to_string(iteration), parsingTaskLambda, std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps));
 
-				return out_generationResult;
-			};
+		//Generate code
+		return _threadPool.submitTask(std::string("Generation ") + std::to_string(iteration), generationTaskLambda, { parsingTask });
+	};
 
-			//Add file to the list of parsed files before starting the task to avoid having to synchronize threads
-			out_genResult.parsedFiles.push_back(file);
+	if (settings.shouldPipelineIterations)
+	{
+		//Lock the thread pool until all tasks have been pushed
+		_threadPool.setIsRunning(false);
 
-			//Parse files
-			//For multiple iterations on a same file, the parsing task depends on the previous generation task for the same file
-			parsingTask = _threadPool.submitTask(std::string("Parsing ") + std::to_string(i), parsingTaskLambda);
+		for (fs::path const& file : toProcessFiles)
+		{
+			std::shared_ptr<TaskBase> previousGenerationTask;
+
+			for (int i = 0; i < iterationCount; i++)
+			{
+				//The parsing task of an iteration N only depends on the generation task of the iteration N - 1 for the same file
+				std::vector<std::shared_ptr<TaskBase>> deps;
+
+				if (previousGenerationTask != nullptr)
+				{
+					deps.emplace_back(previousGenerationTask);
+				}
 
-			//Generate code
-			generationTasks.emplace_back(_threadPool.submitTask(std::string("Generation ") + std::to_string(i), generationTaskLambda, { parsingTask }));
+				previousGenerationTask = generationTasks.emplace_back(submitFileTasks(file, i, std::move(deps)));
+			}
 		}
 
-		//Wait for this iteration to complete before continuing any further
-		//(an iteration N depends on the iteration N - 1)
 		_threadPool.setIsRunning(true);
 		_threadPool.joinWorkers();
 	}
+	else
+	{
+		for (int i = 0; i < iterationCount; i++)
+		{
+			//Lock the thread pool until all tasks have been pushed to avoid competing for the tasks mutex
+			_threadPool.setIsRunning(false);
+
+			for (fs::path const& file : toProcessFiles)
+			{
+				generationTasks.emplace_back(submitFileTasks(file, i, {}));
+			}
+
+			//Wait for this iteration to complete before continuing any further
+			//(an iteration N depends on the iteration N - 1 of all files)
+			_threadPool.setIsRunning(true);
+			_threadPool.joinWorkers();
+		}
+	}
 
 	//Merge all generation results together
 	for (std::shared_ptr<TaskBase>& task : generationTasks)
 	{
 		out_genResult.mergeResult(TaskHelper::getResult<CodeGenResult>(task.get()));
 	}
+	//All files are parsed, so the project hierarchy can be built for the next queries
+	_projectStructClassTree.build();
+}
+
+template <typename FileParserType, typename CodeGenUnitType>
+bool CodeGenManager::processShardFiles(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, std::vector<fs::path> const& files, int channel) noexcept
+{
+	//The worker process only has a single thread, so files are parsed and generated one after the other
+	FileParserType	workerFileParser	= fileParser;
+	uint8			iterationCount		= codeGenUnit.getIterationCount();
+	bool			completed			= true;
+
+	for (uint8 i = 0u; i < iterationCount; i++)
+	{
+		for (fs::path const& file : files)
+		{
+			FileParsingResult	parsingResult	= parseFile(workerFileParser, file);
+			bool				fileCompleted	= generateFile(codeGenUnit, parsingResult);
+
+			completed &= fileCompleted;
+
+			//The main process keeps the state of each file after its last iteration
+			if (i + 1u == iterationCount && !sendShardFileResult(channel, file, parsingResult, fileCompleted))
+			{
+				completed = false;
+			}
+		}
+	}
+
+	return completed;
+}
+
+template <typename FileParserType, typename CodeGenUnitType>
+void CodeGenManager::processFilesInWorkerProcesses(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, std::set<fs::path> const& toProcessFiles, CodeGenResult& out_genResult) noexcept
+{
+	std::vector<std::vector<fs::path>>	shards			= shardFiles(toProcessFiles, settings.workerProcessCount);
+	uint8								iterationCount	= codeGenUnit.getIterationCount();
+	std::vector<ShardWorkerProcess>		workers;
+	std::set<fs::path>					notStartedFiles;
+
+	//Setup the cache before forking so that all workers inherit it
+	if (settings.shouldCacheParsingResults)
+	{
+		setupParsingResultCache(fileParser.getSettings(), codeGenUnit);
+	}
+
+	//Target PCHs are built on first use: build those of the processed files before forking, in parallel,
+	//so that workers inherit them instead of each building the PCHs of its files
+	for (fs::path const& file : toProcessFiles)
+	{
+		_threadPool.submitTask("Precompile prefix header", [&fileParser, &file](TaskBase*)
+							   {
+								   fileParser.getSettings().getCompilationArguments(file);
+							   });
+	}
+
+	_threadPool.joinWorkers();
+
+	//Reserve enough space so that workers are never moved while started
+	workers.reserve(shards.size());
+
+	for (std::vector<fs::path> const& shard : shards)
+	{
+		if (shard.empty())
+		{
+			continue;
+		}
+
+		auto workLambda = [this, &fileParser, &codeGenUnit, &shard](int channel) -> bool
+		{
+			//Only modifies the copy of the manager owned by the worker process
+			_isWorkerProcess = true;
+
+			return processShardFiles(fileParser, codeGenUnit, shard, channel);
+		};
+
+		//The thread pool threads are idle here (joined after the PCH builds above), so none of them
+		//holds a lock the worker could need. Worker processes only contain the forking thread and never use the thread pool.
+		if (workers.emplace_back().start(workLambda, workers))
+		{
+			for (int i = 0; i < iterationCount; i++)
+			{
+				out_genResult.parsedFiles.insert(out_genResult.parsedFiles.cend(), shard.cbegin(), shard.cend());
+			}
+		}
+		else
+		{
+			workers.pop_back();
+			notStartedFiles.insert(shard.cbegin(), shard.cend());
+		}
+	}
+
+	//Results are applied as they arrive, on this thread only
+	ShardWorkerProcess::receiveMessages(workers, [this, &out_genResult](std::string_view message)
+										{
+											applyShardFileResult(message, out_genResult);
+										});
+
+	for (ShardWorkerProcess& worker : workers)
+	{
+		if (!worker.wait())
+		{
+			out_genResult.completed = false;
+		}
+	}
+
+	if (!notStartedFiles.empty())
+	{
+		if (logger != nullptr)
+		{
+			logger->log(std::to_string(notStartedFiles.size()) + " files could not be sent to a worker process. They are processed by the current process.", ILogger::ELogSeverity::Warning);
+		}
+
+		processFiles(fileParser, codeGenUnit, notStartedFiles, out_genResult);
+	}
+
+	_projectStructClassTree.build();
 }
 
 template <typename FileParserType, typename CodeGenUnitType>
@@ -99,24 +322,147 @@ CodeGenResult CodeGenManager::run(FileParserType& fileParser, CodeGenUnitType& c
 	else
 	{
 		//Start timer here
-		auto				start			= std::chrono::high_resolution_clock::now();
-		std::set<fs::path>	filesToProcess	= identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
+		auto start = std::chrono::high_resolution_clock::now();
+
+		//The manifest settings hash includes the compilation arguments, so the parsing settings must be initialized to load it.
+		//parsingSettings can't be nullptr since it has been checked in the checkGenerationSetup call.
+		if (settings.shouldUseGenerationManifest)
+		{
+			fileParser.getSettings().init(logger);
+
+			loadGenerationManifest(fileParser.getSettings(), codeGenUnit);
+		}
+
+		std::set<fs::path> filesToProcess = identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
 
 		//Don't setup anything if there are no files to generate
 		if (filesToProcess.size() > 0u)
 		{
 			//Initialize the parsing settings to setup parser compilation arguments.
-			//parsingSettings can't be nullptr since it has been checked in the checkGenerationSetup call.
-			fileParser.getSettings().init(logger);
+			if (!settings.shouldUseGenerationManifest)
+			{
+				fileParser.getSettings().init(logger);
+			}
 
 			generateMacrosFile(fileParser.getSettings(), codeGenUnit.getSettings()->getOutputDirectory());
 
 			//Start files processing
-			processFiles(fileParser, codeGenUnit, filesToProcess, genResult);
+			if (shouldUseWorkerProcesses(codeGenUnit))
+			{
+				processFilesInWorkerProcesses(fileParser, codeGenUnit, filesToProcess, genResult);
+			}
+			else
+			{
+				processFiles(fileParser, codeGenUnit, filesToProcess, genResult);
+			}
+
+			if (settings.shouldUseGenerationManifest)
+			{
+				saveGenerationManifest(codeGenUnit);
+			}
+
+			//The parsing results of the run are destroyed, only keep the strings still referenced (by the project hierarchy for example)
+			StringTable::getInstance().removeUnreferencedStrings();
 		}
 
 		genResult.duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count() * 0.001f;
 	}
 	
+	return genResult;
+}
+
+template <typename FileParserType, typename CodeGenUnitType>
+CodeGenResult CodeGenManager::watch(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, std::function<bool(CodeGenResult const&)> const& shouldKeepWatching, std::chrono::milliseconds pollingPeriod, bool forceRegenerateAll) noexcept
+{
+	//Check FileParser validity
+	static_assert(std::is_base_of_v<FileParser, FileParserType>, "fileParser type must be a derived class of kodgen::FileParser.");
+	static_assert(std::is_copy_constructible_v<FileParserType>, "The provided file parser must be copy-constructible.");
+
+	//Check FileGenerationUnit validity
+	static_assert(std::is_base_of_v<CodeGenUnit, CodeGenUnitType>, "codeGenUnit type must be a derived class of kodgen::CodeGenUnit.");
+	static_assert(std::is_copy_constructible_v<CodeGenUnitType>, "The CodeGenUnit you provide must be copy-constructible.");
+
+	CodeGenResult genResult;
+
+	if (!checkGenerationSetup(fileParser, codeGenUnit))
+	{
+		return genResult;
+	}
+
+	//Initialize the parsing settings once for all generation passes
+	fileParser.getSettings().init(logger);
+
+	generateMacrosFile(fileParser.getSettings(), codeGenUnit.getSettings()->getOutputDirectory());
+
+	//Keep translation units alive between generation passes
+	TranslationUnitCache	translationUnitCache;
+	TranslationUnitCache*	previousTranslationUnitCache = fileParser.translationUnitCache;
+
+	fileParser.translationUnitCache = &translationUnitCache;
+
+	if (settings.shouldUseGenerationManifest)
+	{
+		loadGenerationManifest(fileParser.getSettings(), codeGenUnit);
+	}
+
+	bool				keepWatching = true;
+	std::set<fs::path>	previousPassFiles;
+
+	while (keepWatching)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+
+		genResult			= CodeGenResult();
+		genResult.completed	= true;
+
+		std::set<fs::path> filesToProcess = identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
+		std::set<fs::path> passFiles = filesToProcess;
+
+		passFiles.insert(genResult.upToDateFiles.cbegin(), genResult.upToDateFiles.cend());
+
+		//Forget the files deleted, renamed or filtered out since the previous pass, so that their inheritance links don't outlive them
+		for (fs::path const& file : previousPassFiles)
+		{
+			if (passFiles.count(file) == 0u)
+			{
+				_projectStructClassTree.removeFile(file);
+
+				if (settings.shouldUseGenerationManifest)
+				{
+					_generationManifest.removeSourceFile(file);
+				}
+			}
+		}
+
+		previousPassFiles = std::move(passFiles);
+
+		if (filesToProcess.size() > 0u)
+		{
+			processFiles(fileParser, codeGenUnit, filesToProcess, genResult);
+
+			if (settings.shouldUseGenerationManifest)
+			{
+				saveGenerationManifest(codeGenUnit);
+			}
+
+			//Release the strings of the entities which disappeared since the previous pass
+			StringTable::getInstance().removeUnreferencedStrings();
+		}
+
+		genResult.duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count() * 0.001f;
+
+		//Only the initial generation can be forced
+		forceRegenerateAll = false;
+
+		keepWatching = shouldKeepWatching(genResult);
+
+		if (keepWatching)
+		{
+			std::this_thread::sleep_for(pollingPeriod);
+		}
+	}
+
+	fileParser.translationUnitCache = previousTranslationUnitCache;
+
 	return genResult;
 }
\ No newline at end of file
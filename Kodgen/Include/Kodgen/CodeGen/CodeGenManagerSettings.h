@@ -11,7 +11,9 @@
 #include <string>
 
 #include "Kodgen/Misc/Settings.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/PathFilter.h"
 
 namespace kodgen
 {
@@ -30,6 +32,7 @@ namespace kodgen
 			/**
 			*	Collection of ignored files.
 			*	These files will never be processed (except if they are also part of the _toProcessFiles collection).
+			*	Paths containing wildcards are glob patterns (see PathFilter).
 			*/
 			std::unordered_set<fs::path, PathHash>	_ignoredFiles;
 
@@ -44,9 +47,13 @@ namespace kodgen
 			*	Collection of ignored directories.
 			*	All directories contained there will be ignored, except if they are included.
 			*	All files contained in any ignored directory will be ignored, except if they are included.
+			*	Paths containing wildcards are glob patterns (see PathFilter).
 			*/
 			std::unordered_set<fs::path, PathHash>	_ignoredDirectories;
 
+			/** Filter built from _ignoredFiles and _ignoredDirectories, used to check ignored paths without accessing the filesystem. */
+			PathFilter								_ignoredPathFilter;
+
 			/** Extensions of files that should be considered for code generation. */
 			std::unordered_set<std::string>			_supportedFileExtensions;
 
@@ -62,6 +69,9 @@ namespace kodgen
 			/** Dirty flag set if _ignoredDirectories hasn't been refreshed since last modification. */
 			bool									_ignoredDirectoriesDirtyFlag	= false;
 
+			/** Dirty flag set if _ignoredPathFilter hasn't been rebuilt since the last modification of _ignoredFiles or _ignoredDirectories. */
+			bool									_ignoredPathFilterDirtyFlag		= false;
+
 			/**
 			*	@brief	Transform all existing paths in a collection in their canonical equivalent if they exist.
 			*			If a path doesn't exist, it remains unchanged in the collection.
@@ -132,7 +142,83 @@ namespace kodgen
 			void			loadIgnoredDirectories(toml::value const&	generationSettings,
 												   ILogger*				logger)					noexcept;
 
+			/**
+			*	@brief Load the shouldPipelineIterations setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadShouldPipelineIterations(toml::value const&	generationSettings,
+														 ILogger*			logger)				noexcept;
+
+			/**
+			*	@brief Load the shouldUseGenerationManifest setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadShouldUseGenerationManifest(toml::value const&	generationSettings,
+															ILogger*			logger)			noexcept;
+
+			/**
+			*	@brief Load the shouldCacheParsingResults setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadShouldCacheParsingResults(toml::value const&	generationSettings,
+														  ILogger*				logger)			noexcept;
+
+			/**
+			*	@brief Load the workerProcessCount setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadWorkerProcessCount(toml::value const&	generationSettings,
+												   ILogger*				logger)					noexcept;
+
 		public:
+			/**
+			*	When a CodeGenUnit requires multiple iterations, should the iterations of each file be pipelined?
+			*	If true, the iteration N of a file only waits for the iteration N - 1 of the same file to complete,
+			*	instead of waiting for the iteration N - 1 of all files. It keeps all threads busy until the last file is processed.
+			*	Only enable this if the code generated for a file never depends on the code generated for other files during the previous iteration.
+			*/
+			bool		shouldPipelineIterations	= false;
+
+			/**
+			*	Should a generation manifest be used to determine whether a file is up-to-date or not?
+			*	If true, a file is regenerated only if its content, the content of a file it includes, or the generation settings changed
+			*	since its last successful generation, or if one of its generated files is missing (see CodeGenUnit::hasGeneratedFiles).
+			*	Last write times are ignored.
+			*	If false, a file is regenerated if it is newer than its generated files (see CodeGenUnit::isUpToDate).
+			*/
+			bool		shouldUseGenerationManifest	= false;
+
+			/**
+			*	Should the parsing results be cached on disk?
+			*	If true, the parsing result of each file is stored in the output directory, and a file is only parsed again if its content,
+			*	its compilation arguments, the parsing settings or the content of a file it includes changed since it was cached.
+			*	Changing only the code generation then doesn't require to parse files again.
+			*/
+			bool		shouldCacheParsingResults	= false;
+
+			/**
+			*	Number of worker processes the files to process are split across by CodeGenManager::run. 0 or 1 processes all files in the current process.
+			*	Each file is always sent to the same worker (as long as the worker count doesn't change), which parses and generates it on a single thread,
+			*	so libclang memory and locks are not shared between workers. The main process merges the results of all the workers.
+			*	During generation, a worker only knows the inheritance links of the files it parsed itself and of the files parsed by previous runs.
+			*	Only supported on POSIX platforms, and requires shouldPipelineIterations if the CodeGenUnit runs multiple iterations.
+			*/
+			uint32		workerProcessCount			= 0u;
+
+			/**
+			*	Version of the code generator using Kodgen (generation modules, code generation unit...).
+			*	It is part of the generation manifest settings hash: changing it invalidates all the manifest entries.
+			*/
+			std::string	generatorVersion;
+
 			/**
 			*	@brief	Add a file to the list of processed files.
 			*			If the path is invalid, doesn't exist, is not a file, or is already in the list, nothing happens.
@@ -254,24 +340,34 @@ namespace kodgen
 
 			/**
 			*	@brief	Check whether the provided path is an ignored file or not.
-			*			The method is not const to allow the path sanitizer to run if the _ignoredFilesDirtyFlag is set.
+			*			The path is made absolute and normalized lexically: symbolic links are not resolved.
+			*			The method is not const to allow the ignored path filter to be rebuilt if it is dirty.
 			* 
 			*	@param file Path to the file.
 			* 
-			*	@return true if the file is ignored, else false.
+			*	@return true if the file or one of its parent directories is ignored, else false.
 			*/
 			bool isIgnoredFile(fs::path const& file)							noexcept;
 
 			/**
 			*	@brief	Check whether the provided path is an ignored directory or not.
-			*			The method is not const to allow the path sanitizer to run if the _ignoredDirectoriesDirtyFlag is set.
+			*			The path is made absolute and normalized lexically: symbolic links are not resolved.
+			*			The method is not const to allow the ignored path filter to be rebuilt if it is dirty.
 			* 
 			*	@param directory Path to the directory.
 			* 
-			*	@return true if the directory is ignored, else false.
+			*	@return true if the directory or one of its parent directories is ignored, else false.
 			*/
 			bool isIgnoredDirectory(fs::path const& directory)					noexcept;
 
+			/**
+			*	@brief	Get the filter of ignored files and directories, rebuilding it first if the ignored paths changed.
+			*			The returned filter can then be used concurrently as long as the settings are not modified.
+			* 
+			*	@return The ignored path filter.
+			*/
+			PathFilter const& getIgnoredPathFilter()							noexcept;
+
 
 			/**
 			*	@brief Getter for _toProcessFiles.
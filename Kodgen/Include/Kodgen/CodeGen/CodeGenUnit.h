@@ -8,6 +8,9 @@
 #pragma once
 
 #include <vector>
+#include <memory>		//std::shared_ptr
+#include <string_view>
+#include <unordered_map>
 #include <functional>	//std::function
 
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
@@ -21,25 +24,81 @@
 
 namespace kodgen
 {
+	//Forward declaration
+	class PropertyCodeGen;
+
 	class CodeGenUnit
 	{
 		private:
+			struct PropertyOccurrence
+			{
+				/** Entity carrying the property. */
+				EntityInfo const*	entity;
+
+				/** Index of the property in the entity's properties. */
+				uint8				propertyIndex;
+
+				/** Mask of the types of all the entities the entity is nested in. */
+				EEntityType			enclosingEntityTypes;
+			};
+
+			struct FlattenedEntity
+			{
+				/** Flattened entity. */
+				EntityInfo const*	entity;
+
+				/** Index of the first flattened entity which is not nested in this entity. */
+				uint32				subtreeEnd;
+
+				/** Index of the first flattened entity which is not nested in this entity or in one of its next siblings of the same type. */
+				uint32				siblingsEnd;
+			};
+
+			/** All the properties of a parsing result grouped by property name, in traversal order. Keys view the property names of the parsing result. */
+			using PropertyDispatchIndex = std::unordered_map<std::string_view, std::vector<PropertyOccurrence>>;
+
+			struct SortedCodeGenerator
+			{
+				/** Index of the module in _generationModules. */
+				uint32	moduleIndex;
+
+				/** Index of the property code generator in the module property code generators, or -1 for the module itself. */
+				int32	propertyCodeGenIndex;
+			};
+
 			/** Collection of all registered generation modules. */
 			std::vector<CodeGenModule*>	_generationModules;
 
+			/**
+			*	Positions of all code generators nested in this CodeGenUnit, sorted by ascending generation order.
+			*	Computed when the registered modules change, and shared by all the copies of this CodeGenUnit since their modules are clones.
+			*/
+			std::shared_ptr<std::vector<SortedCodeGenerator> const>	_sortedCodeGeneratorPositions;
+
+			/** All code generators nested in this CodeGenUnit sorted by ascending generation order, resolved from _sortedCodeGeneratorPositions. */
+			std::vector<ICodeGenerator*>	_sortedCodeGenerators;
+
 			/** Keep track of either this CodeGenUnit instance was constructed from the copy constructor
 			*	or the copy assignement operator.
 			*/
 			bool						_isCopy	= false;
 
 			/**
-			*	@brief Insert a code generator to a sorted vector ordered by generation order.
+			*	@brief Sort all code generators nested in the registered modules by ascending generation order and update _sortedCodeGenerators.
+			*/
+			void						updateSortedCodeGenerators()																			noexcept;
+
+			/**
+			*	@brief	Fill _sortedCodeGenerators with the code generators located at _sortedCodeGeneratorPositions.
+			*/
+			void						resolveSortedCodeGenerators()																			noexcept;
+
+			/**
+			*	@brief Register clones of all the modules of another CodeGenUnit and reuse its code generators order.
 			* 
-			*	@param vector	The collection to insert to.
-			*	@param codeGen	The code generator to insert in the vector.
+			*	@param other The CodeGenUnit to clone modules from.
 			*/
-			static void					sortedInsert(std::vector<ICodeGenerator*>&	vector,
-													 ICodeGenerator&				codeGen)													noexcept;
+			void						cloneGenerationModules(CodeGenUnit const& other)														noexcept;
 
 			/**
 			*	@brief	Delete all the registered generation modules. If they have been dynamically instantiated,
@@ -63,6 +122,151 @@ namespace kodgen
 																								   void const*)>		visitor,
 																 CodeGenEnv&											env)					noexcept;
 
+			/**
+			*	@brief	Iterate over the parsed entities only once and execute a visitor function on each entity/registered code generator pair.
+			*			All code generators run on an entity, by ascending generation order, before moving to the next entity.
+			*			Traversal behaviours returned by a code generator only alter the entities visited by this code generator.
+			* 
+			*	@param visitor	Visitor function to execute on all traversed entities.
+			*	@param env		Generation environment structure.
+			* 
+			*	@return ETraversalBehaviour::Recurse if the traversal completed successfully.
+			*			ETraversalBehaviour::AbortWithSuccess if the traversal was aborted prematurely without error.
+			*			ETraversalBehaviour::AbortWithFailure if the traversal was aborted prematurely with an error.
+			*/
+			ETraversalBehaviour			foreachCodeGenEntityPairSinglePass(std::function<ETraversalBehaviour(ICodeGenerator&,
+																											 EntityInfo const&,
+																											 CodeGenEnv&,
+																											 void const*)>		visitor,
+																		   CodeGenEnv&											env)			noexcept;
+
+			/**
+			*	@brief	Flatten all the entities of a parsing result in traversal order (depth-first, pre-order).
+			* 
+			*	@param parsingResult	Parsing result containing the entities to flatten.
+			*	@param out_entities		Vector the flattened entities are appended to.
+			*/
+			static void					flattenEntities(FileParsingResult const&		parsingResult,
+														std::vector<FlattenedEntity>&	out_entities)											noexcept;
+
+			/**
+			*	@brief Flatten an entity which doesn't contain any nested entity.
+			* 
+			*	@param entity		Entity to flatten.
+			*	@param out_entities	Vector the flattened entity is appended to.
+			*/
+			static void					flattenEntity(EntityInfo const&					entity,
+													  std::vector<FlattenedEntity>&		out_entities)											noexcept;
+
+			/**
+			*	@brief Flatten a namespace and all its nested entities.
+			* 
+			*	@param namespace_	Namespace to flatten.
+			*	@param out_entities	Vector the flattened entities are appended to.
+			*/
+			static void					flattenNamespace(NamespaceInfo const&				namespace_,
+														 std::vector<FlattenedEntity>&		out_entities)										noexcept;
+
+			/**
+			*	@brief Flatten a struct/class and all its nested entities.
+			* 
+			*	@param struct_		Struct/class to flatten.
+			*	@param out_entities	Vector the flattened entities are appended to.
+			*/
+			static void					flattenStruct(StructClassInfo const&			struct_,
+													  std::vector<FlattenedEntity>&		out_entities)											noexcept;
+
+			/**
+			*	@brief Flatten an enum and all its enum values.
+			* 
+			*	@param enum_		Enum to flatten.
+			*	@param out_entities	Vector the flattened entities are appended to.
+			*/
+			static void					flattenEnum(EnumInfo const&					enum_,
+													std::vector<FlattenedEntity>&	out_entities)												noexcept;
+
+			/**
+			*	@brief Set the siblingsEnd field of all the sibling entities flattened since siblingsStart.
+			* 
+			*	@param siblingsStart	Index of the first flattened sibling.
+			*	@param inout_entities	Flattened entities.
+			*/
+			static void					closeFlattenedSiblings(uint32							siblingsStart,
+															   std::vector<FlattenedEntity>&	inout_entities)									noexcept;
+
+			/**
+			*	@brief	Add all the properties of a parsing result to a property dispatch index.
+			* 
+			*	@param parsingResult	Parsing result containing the entities to index.
+			*	@param out_index		Index to fill.
+			*/
+			static void					fillPropertyDispatchIndex(FileParsingResult const&	parsingResult,
+																  PropertyDispatchIndex&	out_index)											noexcept;
+
+			/**
+			*	@brief Add the properties of an entity to a property dispatch index.
+			* 
+			*	@param entity				Entity to index.
+			*	@param enclosingEntityTypes	Mask of the types of all the entities the entity is nested in.
+			*	@param out_index			Index to fill.
+			*/
+			static void					addToPropertyDispatchIndex(EntityInfo const&		entity,
+																   EEntityType				enclosingEntityTypes,
+																   PropertyDispatchIndex&	out_index)											noexcept;
+
+			/**
+			*	@brief Add the properties of a namespace and all its nested entities to a property dispatch index.
+			* 
+			*	@param namespace_			Namespace to index.
+			*	@param enclosingEntityTypes	Mask of the types of all the entities the namespace is nested in.
+			*	@param out_index			Index to fill.
+			*/
+			static void					addNamespaceToPropertyDispatchIndex(NamespaceInfo const&	namespace_,
+																			EEntityType				enclosingEntityTypes,
+																			PropertyDispatchIndex&	out_index)									noexcept;
+
+			/**
+			*	@brief Add the properties of a struct/class and all its nested entities to a property dispatch index.
+			* 
+			*	@param struct_				Struct/class to index.
+			*	@param enclosingEntityTypes	Mask of the types of all the entities the struct/class is nested in.
+			*	@param out_index			Index to fill.
+			*/
+			static void					addStructToPropertyDispatchIndex(StructClassInfo const&		struct_,
+																		 EEntityType				enclosingEntityTypes,
+																		 PropertyDispatchIndex&		out_index)									noexcept;
+
+			/**
+			*	@brief Add the properties of an enum and all its enum values to a property dispatch index.
+			* 
+			*	@param enum_				Enum to index.
+			*	@param enclosingEntityTypes	Mask of the types of all the entities the enum is nested in.
+			*	@param out_index			Index to fill.
+			*/
+			static void					addEnumToPropertyDispatchIndex(EnumInfo const&			enum_,
+																	   EEntityType				enclosingEntityTypes,
+																	   PropertyDispatchIndex&	out_index)										noexcept;
+
+			/**
+			*	@brief	Execute a visitor function on each entity/property pair of a property dispatch index handled by a property code generator.
+			*			Equivalent to a full traversal of the parsed entities with the property code generator, but only visits the entities carrying its property.
+			* 
+			*	@param propertyCodeGen	Property code generator to run.
+			*	@param index			Index containing the properties of the parsed entities.
+			*	@param env				Generation environment structure.
+			*	@param visitor			Visitor function to execute on all matching entity/property pairs.
+			* 
+			*	@return ETraversalBehaviour::Recurse if the traversal completed successfully.
+			*			ETraversalBehaviour::AbortWithFailure if the traversal was aborted prematurely with an error.
+			*/
+			ETraversalBehaviour			foreachPropertyCodeGenEntityPair(PropertyCodeGen&										propertyCodeGen,
+																		 PropertyDispatchIndex const&							index,
+																		 CodeGenEnv&											env,
+																		 std::function<ETraversalBehaviour(ICodeGenerator&,
+																										   EntityInfo const&,
+																										   CodeGenEnv&,
+																										   void const*)>		visitor)		noexcept;
+
 			/**
 			*	@brief	Iterate and execute recursively a visitor function on a namespace and
 			*			all its nested entities/registered module pair.
@@ -248,15 +452,25 @@ namespace kodgen
 															fs::path const& referenceFile)					const	noexcept;
 
 			/**
-			*	@brief Compute the list of all generators nested in this CodeGenUnit sorted by ascending generation order.
+			*	@brief	Get the list of all generators nested in this CodeGenUnit sorted by ascending generation order.
+			*			The list is computed when modules are added or removed, not on each call.
 			* 
 			*	@return The list of sorted code generators.
 			*/
-			std::vector<ICodeGenerator*>	getSortedCodeGenerators()										const	noexcept;
+			std::vector<ICodeGenerator*> const&	getSortedCodeGenerators()									const	noexcept;
 
 		public:
 			/** Logger used to issue logs from this CodeGenUnit. */
-			ILogger*	logger	= nullptr;
+			ILogger*						logger					= nullptr;
+
+			/** Project-wide inheritance hierarchy forwarded to the CodeGenEnv. Set by the CodeGenManager. Can be nullptr. */
+			ProjectStructClassTree const*	projectStructClassTree	= nullptr;
+
+			/**
+			*	Should generated files whose content didn't change be left untouched instead of having their last write time updated?
+			*	Set by the CodeGenManager when the generation manifest, rather than last write times, decides whether files are up-to-date.
+			*/
+			bool							shouldKeepIdenticalGeneratedFiles	= false;
 
 			CodeGenUnit()					= default;
 			CodeGenUnit(CodeGenUnit const&)	noexcept;
@@ -272,6 +486,17 @@ namespace kodgen
 			*/
 			virtual bool				isUpToDate(fs::path const& sourceFile)			const	noexcept = 0;
 
+			/**
+			*	@brief	Check whether all the files generated for a given source file exist, regardless of their last write time.
+			*			Used instead of isUpToDate when the generation manifest decides whether a file is up-to-date.
+			*			The default implementation always returns true: units generating files should override it.
+			* 
+			*	@param sourceFile Path to the source file.
+			*
+			*	@return true if all the files generated for sourceFile exist, else false.
+			*/
+			virtual bool				hasGeneratedFiles(fs::path const& sourceFile)	const	noexcept;
+
 			/**
 			*	@brief	Check whether all settings are setup correctly for this unit to work.
 			*			If output directory path is valid but doesn't exist yet, it is created.
@@ -296,7 +521,8 @@ namespace kodgen
 			bool						generateCode(FileParsingResult const& parsingResult)	noexcept;
 
 			/**
-			*	@brief Add a module to the internal list of generation modules.
+			*	@brief	Add a module to the internal list of generation modules.
+			*			The module property code generators must all be registered at this point.
 			* 
 			*	@param generationModule The generation module to add.
 			*/
@@ -44,10 +44,34 @@ namespace kodgen
 			void			loadOutputDirectory(toml::value const&	generationSettings,
 												ILogger*			logger)						noexcept;
 
+			/**
+			*	@brief Load the shouldTraverseEntitiesOnce setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadShouldTraverseEntitiesOnce(toml::value const&	generationSettings,
+														   ILogger*				logger)			noexcept;
+
 		public:
+			/**
+			*	Should the parsed entities be traversed only once for all the code generators?
+			*	If true, the entity tree is flattened once and all code generators run on an entity (by ascending generation order)
+			*	before moving to the next entity. The generated code is then ordered by entity first, then by generation order.
+			*	If false, the entity tree is traversed once per code generator, so the code generated by a code generator for all entities
+			*	is contiguous.
+			*/
+			bool	shouldTraverseEntitiesOnce	= false;
+
 			/** Name of the header containing all entity macro definitions. */
 			static inline fs::path const entityMacrosFilename	= "EntityMacros.h";
 
+			/** Name of the generation manifest file, written in the output directory when CodeGenManagerSettings::shouldUseGenerationManifest is true. */
+			static inline fs::path const generationManifestFilename	= "GenerationManifest.kgm";
+
+			/** Name of the parsing result cache directory, created in the output directory when CodeGenManagerSettings::shouldCacheParsingResults is true. */
+			static inline fs::path const parsingResultCacheDirectoryName	= "ParsingResultCache";
+
 			/**
 			*	@brief	Setter for _outputDirectory.
 			*			If the path exists check that it is a directory.
@@ -8,9 +8,9 @@
 #pragma once
 
 #include <string>
-#include <fstream>
 
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/ILogger.h"
 
 namespace kodgen
 {
@@ -19,7 +19,31 @@ namespace kodgen
 		private:
 			fs::path		_path;
 			fs::path		_sourceFilePath;
-			std::ofstream	_streamToFile;
+
+			/** Generated content, buffered in memory until the generated file is destroyed. */
+			std::string		_content;
+
+			/** Should the file be left untouched if its content didn't change? If false, its last write time is still updated. */
+			bool			_shouldKeepIdenticalContent	= false;
+
+			/** Logger used to report write failures. Can be nullptr. */
+			ILogger*		_logger						= nullptr;
+
+			/**
+			*	@brief Check whether the file on disk already contains exactly the buffered content.
+			*
+			*	@return true if the file exists and its bytes are identical to _content, else false.
+			*/
+			bool hasSameContentOnDisk()					const	noexcept;
+
+			/**
+			*	@brief Write the buffered content to disk if it differs from the existing file.
+			*	@brief The content is written to a temporary file which then replaces the generated file,
+			*			so that the generated file is never observed half-written.
+			*			Unchanged files are not rewritten: they are left untouched if _shouldKeepIdenticalContent is true,
+			*			else only their last write time is updated since it may be used to check whether they are up-to-date.
+			*/
+			void writeToDisk()							const	noexcept;
 
 			/**
 			*	@brief Write a single line in the generated file
@@ -51,7 +75,9 @@ namespace kodgen
 		public:
 			GeneratedFile()													= delete;
 			GeneratedFile(fs::path&&		generatedFilePath,
-						  fs::path const&	sourceFilePath = fs::path())	noexcept;
+						  fs::path const&	sourceFilePath				= fs::path(),
+						  bool				shouldKeepIdenticalContent	= false,
+						  ILogger*			logger						= nullptr)	noexcept;
 			GeneratedFile(GeneratedFile const&)								= delete;
 			GeneratedFile(GeneratedFile&&)									= delete;
 			~GeneratedFile()												noexcept;
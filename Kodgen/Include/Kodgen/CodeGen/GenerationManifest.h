@@ -0,0 +1,142 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <utility>		//std::pair
+#include <string_view>
+#include <mutex>
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Persistent record of the inputs used to generate code for each source file: the content hash of the source file
+	*	and of all the files it includes, as well as a hash of the settings used for generation.
+	*	A source file is up-to-date if none of these inputs changed since its last successful generation,
+	*	regardless of the files last write time.
+	*/
+	class GenerationManifest
+	{
+		private:
+			struct FileStamp
+			{
+				/** Size of the file when its hash was computed. */
+				uintmax_t	size			= 0u;
+
+				/** Last write time of the file when its hash was computed. */
+				int64		lastWriteTime	= 0;
+
+				/** Hash of the file content. */
+				uint64		contentHash		= 0u;
+			};
+
+			/** First line of a manifest file, used to discard manifests written in an unknown format. */
+			static constexpr char const*	_formatHeader	= "KodgenGenerationManifest 1";
+
+			/** Hash of the settings used for the generation of all recorded source files. */
+			uint64																_settingsHash	= 0u;
+
+			/**
+			*	Last known stamp of each file referenced by the manifest.
+			*	A file content is only hashed again if its size or last write time changed.
+			*/
+			std::unordered_map<fs::path, FileStamp, PathHash>					_fileStamps;
+
+			/** Files (source file included) and their content hash when each source file was last generated. */
+			std::unordered_map<fs::path, std::vector<std::pair<fs::path, uint64>>, PathHash>	_sourceFileInputs;
+
+			/** Mutex protecting all manifest data. */
+			mutable std::mutex													_mutex;
+
+			/**
+			*	@brief Get the content hash of a file, reusing the recorded hash if the file stamp didn't change.
+			* 
+			*	@param file			Path to the file.
+			*	@param out_hash		Hash of the file content.
+			* 
+			*	@return true if the hash could be computed, false if the file doesn't exist or could not be read.
+			*/
+			bool			getFileHash(fs::path const&	file,
+										uint64&			out_hash)				noexcept;
+
+		public:
+			/**
+			*	@brief Hash the whole content of a file.
+			* 
+			*	@param file			Path to the file.
+			*	@param out_hash		Hash of the file content.
+			* 
+			*	@return true if the file could be read, else false.
+			*/
+			static bool		computeFileHash(fs::path const&	file,
+											uint64&			out_hash)			noexcept;
+
+			/**
+			*	@brief Compute a hash which is stable between runs and platforms (FNV-1a).
+			* 
+			*	@param data	Data to hash.
+			*	@param seed	Hash to continue from, to hash multiple data chunks as a whole.
+			* 
+			*	@return The hash of the data.
+			*/
+			static uint64	computeHash(std::string_view	data,
+										uint64				seed = 14695981039346656037u)	noexcept;
+
+			/**
+			*	@brief	Load a manifest file, replacing the current manifest content.
+			*			If the manifest was written with different settings, recorded source files are discarded.
+			* 
+			*	@param manifestFile	Path to the manifest file.
+			*	@param settingsHash	Hash of the settings used for the current generation.
+			* 
+			*	@return true if the manifest file could be loaded, else false.
+			*/
+			bool			load(fs::path const&	manifestFile,
+								 uint64				settingsHash)						noexcept;
+
+			/**
+			*	@brief Write the manifest content to a file. The file is replaced at once, so readers never see a partially written manifest.
+			* 
+			*	@param manifestFile Path to the manifest file.
+			* 
+			*	@return true if the manifest file could be written, else false.
+			*/
+			bool			save(fs::path const& manifestFile)					const	noexcept;
+
+			/**
+			*	@brief Check whether the code generated for a source file is up-to-date, i.e. none of its recorded inputs changed.
+			* 
+			*	@param sourceFile Path to the source file.
+			* 
+			*	@return true if the source file is up-to-date, false if one of its inputs changed or if it has never been recorded.
+			*/
+			bool			isUpToDate(fs::path const& sourceFile)						noexcept;
+
+			/**
+			*	@brief	Record the current inputs of a source file after a successful generation.
+			*			This method can be called concurrently from multiple threads.
+			* 
+			*	@param sourceFile		Path to the generated source file.
+			*	@param includedFiles	All files included, directly or not, by the source file.
+			*/
+			void			updateSourceFile(fs::path const&				sourceFile,
+											 std::vector<fs::path> const&	includedFiles)	noexcept;
+
+			/**
+			*	@brief	Remove a source file from the manifest so that it is processed again on the next generation.
+			*			This method can be called concurrently from multiple threads.
+			* 
+			*	@param sourceFile Path to the source file.
+			*/
+			void			removeSourceFile(fs::path const& sourceFile)				noexcept;
+	};
+}
@@ -162,6 +162,16 @@ namespace kodgen
 			*/
 			virtual bool					isUpToDate(fs::path const& sourceFile)				const	noexcept	override;
 
+			/**
+			*	@brief	Check that both the generated header and source files exist.
+			*			If the generated header file doesn't exist, create it and leave it empty (see isUpToDate).
+			* 
+			*	@param sourceFile Path to the source file.
+			*
+			*	@return true if both generated files exist, else false.
+			*/
+			virtual bool					hasGeneratedFiles(fs::path const& sourceFile)		const	noexcept	override;
+
 			/**
 			*	@brief	Add a module to the internal list of generation modules.
 			*			This method is a more restrictive replacement for the CodeGenUnit::addModule(CodeGenModule&) method.
@@ -0,0 +1,154 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+
+namespace kodgen
+{
+	/**
+	*	On-disk cache of the parsing results of source files, so that a file whose inputs didn't change doesn't have to be parsed again.
+	*	Each source file has a single cache entry, valid as long as the content of the source file, its compilation arguments,
+	*	the parsing settings and the content of all the files it includes are the same as when the entry was stored.
+	*/
+	class ParsingResultCache
+	{
+		public:
+			struct EntryKey
+			{
+				/** Hash of the source file content, its compilation arguments and the parsing settings. */
+				uint64				hash	= 0u;
+
+				/** Time at which the key was computed. Inputs written since then might not match a parsing result started afterwards. */
+				fs::file_time_type	time;
+			};
+
+		private:
+			struct FileStamp
+			{
+				/** Size of the file when its hash was computed. */
+				uintmax_t	size			= 0u;
+
+				/** Last write time of the file when its hash was computed. */
+				int64		lastWriteTime	= 0;
+
+				/** Hash of the file content. */
+				uint64		contentHash		= 0u;
+			};
+
+			/**
+			*	First line of a cache entry, used to discard entries written in an unknown format.
+			*	The header lines are followed by the parsing result serialized in the ParsedFileFormat by a ParsingResultWriter.
+			*/
+			static constexpr char const*	_formatHeader	= "KodgenParsingResultCache 2";
+
+			/** Extension of the cache entry files. */
+			static constexpr char const*	_entryExtension	= ".kpr";
+
+			/** Directory containing the cache entries. */
+			fs::path											_directory;
+
+			/** Hash of the parsing settings shared by all the files. */
+			uint64												_settingsHash	= 0u;
+
+			/**
+			*	Last known stamp of each file hashed by the cache, so that headers included by many files are hashed only once.
+			*	A file content is only hashed again if its size or last write time changed (generated files can change between iterations).
+			*/
+			std::unordered_map<fs::path, FileStamp, PathHash>	_fileStamps;
+
+			/** Mutex protecting _fileStamps. */
+			std::mutex											_mutex;
+
+			/**
+			*	@brief Get the path of the cache entry of a source file.
+			*
+			*	@param file Path to the source file.
+			*
+			*	@return The path of the cache entry.
+			*/
+			fs::path	getEntryPath(fs::path const& file)											const	noexcept;
+
+			/**
+			*	@brief Get the content hash of a file, reusing the recorded hash if the file stamp didn't change.
+			*
+			*	@param file		Path to the file.
+			*	@param out_hash	Hash of the file content.
+			*
+			*	@return true if the hash could be computed, false if the file could not be read.
+			*/
+			bool		getFileHash(fs::path const&	file,
+									uint64&			out_hash)												noexcept;
+
+		public:
+			/**
+			*	@brief	Set the directory and the parsing settings used by the cache.
+			*			Must be called before the cache is used, and again each time the parsing settings change.
+			*
+			*	@param directory	Directory containing the cache entries. It is created if it doesn't exist.
+			*	@param settingsHash	Hash of all the parsing settings affecting parsing results.
+			*
+			*	@return true if the cache directory exists, else false.
+			*/
+			bool	setup(fs::path const&	directory,
+						  uint64			settingsHash)												noexcept;
+
+			/**
+			*	@brief	Compute the key of a source file from its content, its compilation arguments and the parsing settings.
+			*			The key must be computed before the file is parsed, so that a file edited during the parsing is not stored
+			*			with a key matching its new content.
+			*			This method can be called concurrently from multiple threads.
+			*
+			*	@param file					Path to the source file.
+			*	@param compilationArguments	Arguments used to parse the source file.
+			*	@param out_key				The computed key.
+			*
+			*	@return true if the key could be computed, false if the source file could not be read.
+			*/
+			bool	computeKey(fs::path const&					file,
+							   std::vector<char const*> const&	compilationArguments,
+							   EntryKey&						out_key)									noexcept;
+
+			/**
+			*	@brief	Load the cached parsing result of a source file.
+			*			This method can be called concurrently from multiple threads.
+			*
+			*	@param file			Path to the source file.
+			*	@param key			Key of the source file (see computeKey).
+			*	@param out_result	Parsing result filled with the cached data. It should be empty when this method is called.
+			*
+			*	@return true if a valid entry was loaded, false if the file must be parsed (in which case out_result content is unspecified).
+			*/
+			bool	load(fs::path const&		file,
+						 EntryKey const&		key,
+						 FileParsingResult&		out_result)													noexcept;
+
+			/**
+			*	@brief	Store the parsing result of a source file, replacing any previous entry of the file.
+			*			Nothing is stored if the source file or one of its included files was written since the key was computed,
+			*			since the parsing might have read contents which don't match the recorded hashes.
+			*			This method can be called concurrently from multiple threads, as long as 2 threads don't store the same file.
+			*
+			*	@param file		Path to the source file, as provided to load.
+			*	@param key		Key of the source file, computed before the file was parsed.
+			*	@param result	Successful parsing result of the source file.
+			*
+			*	@return true if the entry was written, else false.
+			*/
+			bool	store(fs::path const&			file,
+						  EntryKey const&			key,
+						  FileParsingResult const&	result)													noexcept;
+	};
+}
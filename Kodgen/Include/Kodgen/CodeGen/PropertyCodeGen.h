@@ -17,8 +17,14 @@
 
 namespace kodgen
 {
+	//Forward declaration
+	class CodeGenUnit;
+
 	class PropertyCodeGen : public ICodeGenerator
 	{
+		//CodeGenUnit dispatches entity/property pairs directly through callVisitorOnProperty.
+		friend CodeGenUnit;
+
 		private:
 			struct AdditionalData
 			{
@@ -68,13 +74,34 @@ namespace kodgen
 															  void const*		data)										noexcept final override;
 
 			/**
-			*	@brief	Determine whether this PropertyCodeGen should recurse on the provided entity children or not.
+			*	@brief	Call the visitor method on a single entity/property pair found by the CodeGenUnit property dispatch index.
+			*			Produces the same calls as the traversal through callVisitorOnEntity, without visiting entities which don't carry the property.
+			* 
+			*	@param entity				The entity provided to the visitor.
+			*	@param propertyIndex		Index of the property in the entity's properties.
+			*	@param enclosingEntityTypes	Mask of the types of all the entities the entity is nested in.
+			*	@param env					The environment provided to the visitor.
+			*	@param visitor				The visitor to run.
 			* 
-			*	@param entity The entity to check.
+			*	@return	AbortWithFailure if the visitor call returned AbortWithFailure, else Recurse.
+			*/
+			ETraversalBehaviour			callVisitorOnProperty(EntityInfo const&										entity,
+															  uint8													propertyIndex,
+															  EEntityType											enclosingEntityTypes,
+															  CodeGenEnv&											env,
+															  std::function<ETraversalBehaviour(ICodeGenerator&,
+																								EntityInfo const&,
+																								CodeGenEnv&,
+																								void const*)>		visitor)			noexcept;
+
+			/**
+			*	@brief	Determine whether this PropertyCodeGen should recurse on the children of an entity or not.
+			* 
+			*	@param entityType The type of the entity to check.
 			* 
 			*	@return true if the generator should run on the entity's children, else false.
 			*/
-			bool						shouldIterateOnNestedEntities(EntityInfo const& entity)						const	noexcept;
+			bool						shouldIterateOnNestedEntities(EEntityType entityType)						const	noexcept;
 
 		public:
 			/**
@@ -102,7 +129,8 @@ namespace kodgen
 															  std::string&		inout_result)					noexcept = 0;
 
 			/**
-			*	@brief Check if this property should generate code for the provided entity/property pair.
+			*	@brief	Check if this property should generate code for the provided entity/property pair.
+			*			If usesPropertyDispatchIndex returns true, this method is only called for properties named getPropertyName().
 			*
 			*	@param entity			Checked entity.
 			*	@param property			Checked property.
@@ -114,6 +142,15 @@ namespace kodgen
 																	Property const&		property,
 																	uint8				propertyIndex)	const	noexcept;
 
+			/**
+			*	@brief	Should the CodeGenUnit only run this generator on the entities carrying a property named getPropertyName()?
+			*			The entities are then found through an index of the parsing result properties instead of a walk of the whole entity tree.
+			*			Only override to return true if shouldGenerateCodeForEntity never accepts a property with another name.
+			*
+			*	@return true to be dispatched through the CodeGenUnit property index, false to visit all entities (default).
+			*/
+			virtual bool				usesPropertyDispatchIndex()										const	noexcept;
+
 			/**
 			*	@brief Getter for _eligibleEntityMask field.
 			* 
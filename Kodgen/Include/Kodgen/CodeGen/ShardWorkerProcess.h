@@ -0,0 +1,113 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>	//std::function
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Child process processing a shard of the files to generate, forked from the current process.
+	*	The worker sends messages to the main process through a pipe, each message being prefixed with its size.
+	*	Worker processes are only supported on POSIX platforms.
+	*/
+	class ShardWorkerProcess
+	{
+		public:
+			/**
+			*	Function executed by the worker process. It receives the channel to provide to sendMessage,
+			*	and returns true if all its work completed successfully.
+			*/
+			using WorkFunction		= std::function<bool(int channel)>;
+
+			/** Function called by the main process for each message received from a worker. */
+			using MessageHandler	= std::function<void(std::string_view message)>;
+
+		private:
+			/** Id of the worker process, -1 if the worker is not running. */
+			int64		_processId	= -1;
+
+			/** Read end of the pipe the worker sends its messages to, -1 once the worker closed it. */
+			int			_channel	= -1;
+
+			/** Received bytes which don't make a complete message yet. */
+			std::string	_pendingData;
+
+			/**
+			*	@brief Read the data available on the channel and call onMessage for each complete message.
+			*
+			*	@param onMessage Function called for each received message.
+			*
+			*	@return false if the worker closed the channel or if it can't be read anymore, else true.
+			*/
+			bool	receive(MessageHandler const& onMessage)								noexcept;
+
+			/**
+			*	@brief Close the channel if it is open.
+			*/
+			void	closeChannel()															noexcept;
+
+		public:
+			ShardWorkerProcess()							= default;
+			ShardWorkerProcess(ShardWorkerProcess const&)	= delete;
+			ShardWorkerProcess(ShardWorkerProcess&& other)	noexcept;
+			~ShardWorkerProcess()							noexcept;
+
+			/**
+			*	@return true if worker processes can be started on the current platform, else false.
+			*/
+			static bool	isSupported()														noexcept;
+
+			/**
+			*	@brief	Fork the current process and run the provided work in the child process, which exits as soon as the work returns.
+			*			The child process only contains the thread which called start: the work must not rely on other threads (thread pools...),
+			*			nor on any lock another thread could hold when start is called.
+			*			SIGPIPE is ignored in the child process, so sendMessage fails instead of killing it if the main process stops listening.
+			*
+			*	@param work				Function executed by the worker process.
+			*	@param startedWorkers	Workers started before this one. The child process closes its copy of their channels.
+			*
+			*	@return true if the worker process was started, else false.
+			*/
+			bool		start(WorkFunction const&						work,
+							  std::vector<ShardWorkerProcess> const&	startedWorkers)				noexcept;
+
+			/**
+			*	@brief Send a message from a worker process to the main process. Blocks until the whole message is written.
+			*
+			*	@param channel Channel provided to the work function.
+			*	@param message Message to send.
+			*
+			*	@return true if the message was sent, else false.
+			*/
+			static bool	sendMessage(int					channel,
+									std::string_view	message)							noexcept;
+
+			/**
+			*	@brief	Receive the messages of all the workers until they all closed their channel.
+			*			Channels are read as data is available, so that no worker is blocked while the main process waits for another one.
+			*
+			*	@param workers		Started workers.
+			*	@param onMessage	Function called on the calling thread for each received message.
+			*/
+			static void	receiveMessages(std::vector<ShardWorkerProcess>&	workers,
+										MessageHandler const&				onMessage)		noexcept;
+
+			/**
+			*	@brief Wait for the worker process to exit.
+			*
+			*	@return true if the work completed successfully and all its messages were received, else false.
+			*/
+			bool		wait()																noexcept;
+	};
+}
@@ -28,6 +28,7 @@ namespace kodgen
 			/** Memory offset in bytes. */
 			int64							memoryOffset;
 
+			FieldInfo()								noexcept;
 			FieldInfo(CXCursor const&			cursor,
 					  std::vector<Property>&&	propertyGroup)	noexcept;
 	};
@@ -0,0 +1,101 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <shared_mutex>
+
+#include "Kodgen/InfoStructures/StructClassTree.h"
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	/**
+	*	Thread-safe inheritance hierarchy of a whole project, merged from the StructClassTree of each parsed file.
+	*	Files can be updated concurrently while other threads query the hierarchy. The contribution of a new file is merged
+	*	directly into the merged tree, while replacing or removing the contribution of a file requires the merged tree
+	*	to be rebuilt from all files: the rebuild is done lazily by the next query, so consecutive replacements are batched.
+	*	Merging new files doesn't build the merged tree, so queries traverse the hierarchy until build() is called
+	*	once all files are parsed, or until the next rebuild.
+	*/
+	class ProjectStructClassTree
+	{
+		private:
+			/** Inheritance hierarchy contributed by each file. */
+			std::unordered_map<fs::path, StructClassTree, PathHash>	_fileStructClassTrees;
+
+			/**
+			*	Merged hierarchy of all files. Rebuilt on demand when _isMergedTreeDirty is true.
+			*	New files are merged without building it, so it is built by the next rebuild or call to build().
+			*/
+			mutable StructClassTree									_mergedStructClassTree;
+
+			/** Does _mergedStructClassTree contain outdated contributions, so that it must be rebuilt from all files? */
+			mutable bool											_isMergedTreeDirty	= false;
+
+			/** Mutex protecting all fields. Queries only take a shared lock unless the merged tree must be rebuilt. */
+			mutable std::shared_mutex								_mutex;
+
+			/**
+			*	@brief	Make the merged tree up-to-date and built: rebuild it from all file contributions if it is dirty,
+			*			else only build it if files were merged since the last build. _mutex must be exclusively locked.
+			*/
+			void	refreshMergedTree()								const	noexcept;
+
+		public:
+			/**
+			*	@brief Set the inheritance hierarchy contributed by a file, replacing any previous contribution of the same file.
+			*
+			*	@param file					Path to the parsed file.
+			*	@param fileStructClassTree	Inheritance hierarchy resulting from the file parsing.
+			*/
+			void			updateFile(fs::path const&			file,
+									   StructClassTree const&	fileStructClassTree)			noexcept;
+
+			/**
+			*	@brief Remove the contribution of a file.
+			*
+			*	@param file Path to the file.
+			*/
+			void			removeFile(fs::path const& file)								noexcept;
+
+			/**
+			*	@brief Remove the contributions of all files.
+			*/
+			void			clear()															noexcept;
+
+			/**
+			*	@brief	Precompute the ancestors of the merged hierarchy, so that the following queries don't traverse it anymore.
+			*			Should be called once all files are parsed: files merged afterwards leave the merged tree unbuilt.
+			*/
+			void			build()															noexcept;
+
+			/**
+			*	@brief	Check whether baseStructClass is a base of childStructClass (parent class or the class itself) in the whole project.
+			*			See StructClassTree::isBaseOf for details.
+			*
+			*	@param baseStructClassName	Canonical name of the base class.
+			*	@param childStructClassName	Canonical name of the child class.
+			*	@param inheritanceAccess	Optional inheritance access filled if true is returned.
+			*
+			*	@return true if baseClass is a parent of childClass, or if baseClass is childClass, else false.
+			*/
+			bool			isBaseOf(std::string const&	baseStructClassName,
+									 std::string const&	childStructClassName,
+									 EAccessSpecifier*	out_inheritanceAccess = nullptr)	const	noexcept;
+
+			/**
+			*	@brief	Get a copy of the merged hierarchy, to run many queries without locking.
+			*			The copy doesn't reflect files updated after this call.
+			*
+			*	@return The merged inheritance hierarchy of all files.
+			*/
+			StructClassTree	getSnapshot()													const	noexcept;
+	};
+}
\ No newline at end of file
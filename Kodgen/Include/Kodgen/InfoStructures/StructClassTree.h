@@ -5,46 +5,114 @@
 *	See the LICENSE.md file for full license details.
 */
 
-#include <functional>	//std::hash
+#pragma once
+
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
 #include "Kodgen/Misc/EAccessSpecifier.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/InternedString.h"
 
 namespace kodgen
 {
+	//Forward declaration
+	class ParsingResultReader;
+
+	/**
+	*	Inheritance hierarchy of structs/classes.
+	*	Each struct/class is a node identified by an integer id. Once all links are added, build() compacts the hierarchy
+	*	and precomputes the ancestors of each node so that isBaseOf doesn't have to traverse the hierarchy anymore.
+	*/
 	class StructClassTree
 	{
+		//ParsingResultReader adds the nodes back in their serialized order, so that node ids survive a round trip.
+		friend ParsingResultReader;
+
 		public:
+			using NodeId = uint32;
+
+			/** Id returned when a struct/class is not part of the tree. */
+			static constexpr NodeId	invalidNodeId = static_cast<NodeId>(-1);
+
 			struct InheritanceLink
 			{
-				/** Name of the inherited struct/class. */
-				std::string			inheritedStructClassName;
+				/** Id of the inherited struct/class. */
+				NodeId				inheritedStructClass;
 
 				/** Inheritance access. */
 				EAccessSpecifier	inheritanceAccess;
 			};
 
 		private:
-			/** Collection mapping a struct/class name to its inherited structs/classes. */
-			std::unordered_map<std::string, std::vector<InheritanceLink>> entries;
+			/** Canonical name of each node, indexed by node id. */
+			std::vector<InternedString>						_nodeNames;
+
+			/** Node id of each struct/class name. Keys view the interned names so that lookups don't need to intern the searched name. */
+			std::unordered_map<std::string_view, NodeId>	_nodeIds;
+
+			/** Direct parents of each node, indexed by node id. */
+			std::vector<std::vector<InheritanceLink>>		_parents;
+
+			/**
+			*	Ancestors (direct and indirect parents) of each node, sorted by node id.
+			*	Ancestors of node i are stored in _ancestors[_ancestorsOffsets[i], _ancestorsOffsets[i + 1]).
+			*/
+			std::vector<InheritanceLink>					_ancestors;
+			std::vector<uint32>								_ancestorsOffsets;
+
+			/** Is _ancestors up-to-date with _parents? */
+			bool											_isBuilt	= true;
+
+			/**
+			*	@brief Get the id of a node, creating the node if it doesn't exist yet.
+			*
+			*	@param structClassName Canonical name of the struct/class.
+			*
+			*	@return The id of the node.
+			*/
+			NodeId	getOrAddNode(std::string const& structClassName)						noexcept;
+
+			/**
+			*	@brief	Traverse the parents of a node breadth first, calling the visitor on each reached inheritance link.
+			*			Each ancestor is visited once, through the first link reaching it.
+			*
+			*	@param node		Node whose parents are traversed.
+			*	@param visitor	Function called on each reached link. Returning true stops the traversal.
+			*/
+			template <typename Functor>
+			void	foreachAncestorLink(NodeId node, Functor visitor)				const	noexcept;
 
 		public:
 			/**
 			*	@brief	Add an inheritance link between currentClass and parentClass.
 			*			If entries corresponding to currentClass and parentClass don't exist yet, they are created.
-			* 
+			*
 			*	@param childStructClassName		Name of the child struct/class.
 			*	@param parentStructClassName	Name of the parent struct/class.
 			*	@param inheritanceAccess		Inheritance specifier.
-			* 
+			*
 			*	@return true if the inheritance link was added, else false (the link already existed before).
 			*/
 			bool	addInheritanceLink(std::string const&	childStructClassName,
 									   std::string const&	parentStructClassName,
 									   EAccessSpecifier		inheritanceAccess)				noexcept;
 
+			/**
+			*	@brief	Add all the structs/classes and inheritance links of another tree to this tree.
+			*
+			*	@param other The tree to merge into this tree.
+			*/
+			void	merge(StructClassTree const& other)										noexcept;
+
+			/**
+			*	@brief	Precompute the ancestors of each struct/class, so that isBaseOf doesn't traverse the hierarchy anymore.
+			*			Must be called again after links are added. Until then, isBaseOf falls back to a traversal of the hierarchy.
+			*/
+			void	build()																	noexcept;
+
 			/**
 			*	@brief	Check whether baseStructClass is a base of childStructClass (parent class or the class itself).
 			*			Canonical names must be used.
@@ -63,10 +131,51 @@ namespace kodgen
 							 EAccessSpecifier*	out_inheritanceAccess = nullptr)	const	noexcept;
 
 			/**
-			*	@brief Getter for entries field.
+			*	@brief	Same as isBaseOf(std::string const&, std::string const&, EAccessSpecifier*), using node ids.
+			*			Prefer this overload to check many pairs of structs/classes since names don't have to be looked up.
 			*
-			*	@return entries.
+			*	@param baseNode		Id of the base class node.
+			*	@param childNode	Id of the child class node.
+			*	@param inheritanceAccess	Optional inheritance access filled if true is returned. In the case baseStruct is childStruct, EAccessSpecifier::Invalid is used.
+			*
+			*	@return true if baseNode is a parent of childNode, or if baseNode is childNode, else false.
 			*/
-			std::unordered_map<std::string, std::vector<InheritanceLink>> const&	getEntries()	const	noexcept;
+			bool	isBaseOf(NodeId				baseNode,
+							 NodeId				childNode,
+							 EAccessSpecifier*	out_inheritanceAccess = nullptr)	const	noexcept;
+
+			/**
+			*	@brief Find the node of a struct/class.
+			*
+			*	@param structClassName Canonical name of the struct/class.
+			*
+			*	@return The id of the node, or invalidNodeId if the struct/class is not part of the tree.
+			*/
+			NodeId									findNode(std::string_view structClassName)	const	noexcept;
+
+			/**
+			*	@brief Get the canonical name of a node.
+			*
+			*	@param node Id of the node.
+			*
+			*	@return The canonical name of the struct/class.
+			*/
+			InternedString const&					getNodeName(NodeId node)					const	noexcept;
+
+			/**
+			*	@brief Get the direct parents of a node.
+			*
+			*	@param node Id of the node.
+			*
+			*	@return The direct inheritance links of the struct/class.
+			*/
+			std::vector<InheritanceLink> const&		getParents(NodeId node)						const	noexcept;
+
+			/**
+			*	@return The number of structs/classes in the tree.
+			*/
+			size_t									getNodeCount()								const	noexcept;
 	};
+
+	#include "Kodgen/InfoStructures/StructClassTree.inl"
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Functor>
+void StructClassTree::foreachAncestorLink(NodeId node, Functor visitor) const noexcept
+{
+	std::vector<bool>	visited(_parents.size(), false);
+	std::vector<NodeId>	toCheck{ node };
+
+	visited[node] = true;
+
+	//toCheck is used as a FIFO queue, index being the queue front
+	for (size_t index = 0u; index < toCheck.size(); index++)
+	{
+		for (InheritanceLink const& inheritanceLink : _parents[toCheck[index]])
+		{
+			if (!visited[inheritanceLink.inheritedStructClass])
+			{
+				visited[inheritanceLink.inheritedStructClass] = true;
+
+				if (visitor(inheritanceLink))
+				{
+					return;
+				}
+
+				toCheck.push_back(inheritanceLink.inheritedStructClass);
+			}
+		}
+	}
+}
\ No newline at end of file
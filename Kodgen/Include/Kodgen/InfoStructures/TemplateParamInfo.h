@@ -42,6 +42,7 @@ namespace kodgen
 			*/
 			std::string					name;
 
+			TemplateParamInfo()					noexcept;
 			TemplateParamInfo(CXCursor cursor)	noexcept;
 	};
 }
\ No newline at end of file
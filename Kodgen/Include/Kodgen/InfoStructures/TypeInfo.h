@@ -13,13 +13,21 @@
 #include <clang-c/Index.h>
 
 #include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/InternedString.h"
 #include "Kodgen/InfoStructures/TypeDescriptor.h"
 #include "Kodgen/InfoStructures/TemplateParamInfo.h"
 
 namespace kodgen
 {
+	//Forward declaration
+	class ParsingResultWriter;
+	class ParsingResultReader;
+
 	class TypeInfo
 	{
+		friend ParsingResultWriter;
+		friend ParsingResultReader;
+
 		private:
 			/** Internal keywords used for type splitting. */
 			static constexpr char const*	_classQualifier		= "class ";
@@ -33,11 +41,12 @@ namespace kodgen
 			*	such as const, volatile or nested info (namespace, outer class).
 			*
 			*	i.e. const volatile ExampleNamespace::ExampleClass *const*&
+			*	Type names are interned since the same types are used all over a project.
 			*/
-			std::string						_fullName			= "";
+			InternedString					_fullName;
 
 			/** The canonical full name is the full name simplified by unwinding all aliases / typedefs. */
-			std::string						_canonicalFullName	= "";
+			InternedString					_canonicalFullName;
 
 			/** List of typenames of the template type, empty if this is not a template type. */
 			std::vector<TemplateParamInfo>	_templateParameters;
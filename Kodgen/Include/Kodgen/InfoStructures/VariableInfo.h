@@ -28,6 +28,7 @@ namespace kodgen
 			/** Type of this variable. */
 			TypeInfo			type;
 
+			VariableInfo()									noexcept;
 			VariableInfo(CXCursor const&			cursor,
 						 std::vector<Property>&&	properties)	noexcept;
 	};
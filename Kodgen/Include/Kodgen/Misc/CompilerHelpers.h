@@ -13,6 +13,7 @@
 #include <string_view>
 
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/Optional.h"
 
 namespace kodgen
 {
@@ -25,6 +26,63 @@ namespace kodgen
 			static constexpr std::string_view gccCompilerName	= "gcc";
 			static constexpr std::string_view gccCompilerName2	= "g++";
 
+			/** First line of compiler cache files, to be bumped whenever the cache file format changes. */
+			static constexpr std::string_view cacheFileHeader	= "KodgenCompilerCache 1";
+
+			/**
+			*	Result of the compiler queries, cached on disk so that following runs don't have to spawn the compiler again.
+			*	Unset fields have not been queried yet.
+			*/
+			struct CachedCompilerInfo
+			{
+				/** Identifies the compiler binary. Empty if the compiler could not be located, in which case nothing is cached. */
+				std::string								stamp;
+
+				/** Result of isClangSupported / isGCCSupported. */
+				opt::optional<bool>						isSupported;
+
+				/** Result of getClangNativeIncludeDirectories / getGCCNativeIncludeDirectories. */
+				opt::optional<std::vector<fs::path>>	nativeIncludeDirectories;
+			};
+
+			/**
+			*	@brief Compute the string identifying a compiler binary: its canonical path (which contains the version
+			*			on most installations since compiler drivers are usually symlinks to a versioned executable),
+			*			its last write time and its size. Any compiler update changes the stamp.
+			*
+			*	@param normalizedCompilerExeName Normalized name of the compiler executable.
+			*
+			*	@return The compiler stamp, or an empty string if the compiler executable could not be located.
+			*/
+			static std::string				computeCompilerStamp(std::string const& normalizedCompilerExeName)			noexcept;
+
+			/**
+			*	@brief Get the path of the cache file of a compiler, located in the user cache directory (see System::getUserCacheDirectory).
+			*
+			*	@param normalizedCompilerExeName Normalized name of the compiler executable.
+			*
+			*	@return The path of the cache file, or an empty path if no user cache directory is available.
+			*/
+			static fs::path					getCompilerCacheFilePath(std::string const& normalizedCompilerExeName)		noexcept;
+
+			/**
+			*	@brief Load the cached queries of a compiler.
+			*
+			*	@param normalizedCompilerExeName Normalized name of the compiler executable.
+			*
+			*	@return The cached compiler info. Cached fields are discarded if the compiler binary changed since they were saved.
+			*/
+			static CachedCompilerInfo		loadCachedCompilerInfo(std::string const& normalizedCompilerExeName)		noexcept;
+
+			/**
+			*	@brief Save the queries of a compiler to its cache file. Nothing is saved if the info stamp is empty.
+			*
+			*	@param normalizedCompilerExeName	Normalized name of the compiler executable.
+			*	@param compilerInfo					Info to save.
+			*/
+			static void						saveCachedCompilerInfo(std::string const&			normalizedCompilerExeName,
+																   CachedCompilerInfo const&	compilerInfo)				noexcept;
+
 			/**
 			*	@brief Retrieve all clang native include directories on the executing computer.
 			*
@@ -109,6 +167,15 @@ namespace kodgen
 			static bool						isClang(std::string const& normalizedCompilerExeName)				noexcept;
 			static bool						isGCC(std::string const& normalizedCompilerExeName)					noexcept;
 
+			/**
+			*	@brief Get the string identifying the installed binary of a compiler, which changes whenever the compiler is updated.
+			*
+			*	@param compilerExeName Name of the compiler executable.
+			*
+			*	@return The compiler stamp, or an empty string if the compiler executable could not be located.
+			*/
+			static std::string				getCompilerStamp(std::string const& compilerExeName)				noexcept;
+
 			/**
 			*	@brief Retrieve all native include directories of a given compiler on the executing computer.
 			*
@@ -64,5 +64,15 @@ namespace kodgen
 			*/
 			static bool		isChildPath(fs::path const& child,
 										fs::path const& other)			noexcept;
+
+			/**
+			*	@brief	Make a path to write a file to before renaming it to its final path, so that readers never see a partially written file.
+			*			The path is unique among all threads and processes, so concurrent writers of the same file don't overwrite each other.
+			*
+			*	@param path Final path of the written file.
+			*
+			*	@return path suffixed by a unique temporary extension, in the same directory so that the rename doesn't cross filesystems.
+			*/
+			static fs::path	makeTemporaryPath(fs::path const& path)		noexcept;
 	};
 }
\ No newline at end of file
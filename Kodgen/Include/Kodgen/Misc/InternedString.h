@@ -0,0 +1,79 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <functional>	//std::hash
+
+#include "Kodgen/Misc/StringTable.h"
+
+namespace kodgen
+{
+	/**
+	*	Lightweight handle on a string interned in the StringTable.
+	*	Copying a handle never allocates, and 2 handles are equal if and only if they point to the same interned string,
+	*	so equality is a pointer comparison.
+	*	Handles reference count their string, so that the table can release the strings which are not used anymore.
+	*/
+	class InternedString
+	{
+		private:
+			/** Entry of the interned string this handle refers to. Never nullptr. */
+			StringTable::Entry*	_entry;
+
+		public:
+			/**
+			*	@brief Construct a handle on the empty string.
+			*/
+			InternedString()								noexcept;
+
+			/**
+			*	@brief Intern the provided string and construct a handle on it.
+			*
+			*	@param string Content of the string to intern.
+			*/
+			InternedString(std::string_view string)			noexcept;
+			InternedString(std::string const& string)		noexcept;
+
+			InternedString(InternedString const& other)		noexcept;
+			~InternedString()								noexcept;
+
+			/**
+			*	@return The interned string.
+			*/
+			std::string const&	str()				const	noexcept;
+
+			/**
+			*	@return true if the interned string is empty, else false.
+			*/
+			bool				empty()				const	noexcept;
+
+			operator std::string const&()			const	noexcept;
+
+			InternedString& operator=(InternedString const& other)	noexcept;
+
+			bool operator==(InternedString const& other)	const	noexcept;
+			bool operator!=(InternedString const& other)	const	noexcept;
+
+			friend struct std::hash<InternedString>;
+	};
+}
+
+namespace std
+{
+	/** Interned strings are hashed by address, like they are compared. */
+	template <>
+	struct hash<kodgen::InternedString>
+	{
+		size_t operator()(kodgen::InternedString const& internedString) const noexcept
+		{
+			return std::hash<void const*>()(internedString._entry);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>	//std::less
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Set of ignored directories and files matched with pure in-memory comparisons.
+	*	Plain paths are stored in a trie of path components: a directory ignores all its content.
+	*	Paths containing * (any characters inside a component), ? (any single character) or ** (any number of components)
+	*	are glob patterns. Relative patterns can match anywhere in a path, as if they started with a ** component.
+	*	Patterns are normalized lexically when added, so . and .. components are never matched literally.
+	*	Checked paths are compared lexically: they must be absolute and normalized for the filter to work as expected.
+	*/
+	class PathFilter
+	{
+		private:
+			struct TrieNode
+			{
+				/** Children nodes indices, by path component. */
+				std::map<std::string, uint32, std::less<>>	children;
+
+				/** Is the path ending at this node an ignored directory? */
+				bool										isIgnoredDirectory	= false;
+
+				/** Is the path ending at this node an ignored file? */
+				bool										isIgnoredFile		= false;
+			};
+
+			/** Nodes of the trie. The root node is at index 0. */
+			std::vector<TrieNode>					_nodes				= std::vector<TrieNode>(1u);
+
+			/** Ignored directory patterns, split in components. */
+			std::vector<std::vector<std::string>>	_directoryPatterns;
+
+			/** Ignored file patterns, split in components. */
+			std::vector<std::vector<std::string>>	_filePatterns;
+
+			/**
+			*	@brief	Split a path in components. The root of an absolute path is an empty first component.
+			*
+			*	@param path				Generic string of the path to split.
+			*	@param out_components	Vector the components are appended to. They view the provided string.
+			*/
+			static void	splitPath(std::string_view					path,
+								  std::vector<std::string_view>&	out_components)					noexcept;
+
+			/**
+			*	@brief Check whether a path string is a glob pattern or not.
+			*
+			*	@param path The path string to check.
+			*
+			*	@return true if the path contains a wildcard, else false.
+			*/
+			static bool	isPattern(std::string_view path)											noexcept;
+
+			/**
+			*	@brief Check whether a single path component matches a pattern component containing * and ? wildcards.
+			*
+			*	@param pattern		Pattern component.
+			*	@param component	Path component.
+			*
+			*	@return true if the component matches the pattern, else false.
+			*/
+			static bool	matchComponent(std::string_view	pattern,
+									   std::string_view	component)									noexcept;
+
+			/**
+			*	@brief Check whether the first components of a path match a pattern.
+			*
+			*	@param pattern			Pattern components.
+			*	@param patternIndex		Index of the first pattern component to match.
+			*	@param components		Path components.
+			*	@param componentIndex	Index of the first path component to match.
+			*	@param componentCount	Number of path components to match.
+			*
+			*	@return true if components [componentIndex, componentCount[ match the pattern components [patternIndex, end[.
+			*/
+			static bool	matchPattern(std::vector<std::string> const&		pattern,
+									 size_t									patternIndex,
+									 std::vector<std::string_view> const&	components,
+									 size_t									componentIndex,
+									 size_t									componentCount)					noexcept;
+
+			/**
+			*	@brief Add a pattern or a plain path to the filter.
+			*
+			*	@param path			The path to add.
+			*	@param isDirectory	Is the path a directory or a file?
+			*/
+			void		add(fs::path const&	path,
+							bool			isDirectory)											noexcept;
+
+		public:
+			/**
+			*	@brief Add an ignored directory or directory pattern.
+			*
+			*	@param directory The directory to ignore.
+			*/
+			void	addIgnoredDirectory(fs::path const& directory)				noexcept;
+
+			/**
+			*	@brief Add an ignored file or file pattern.
+			*
+			*	@param file The file to ignore.
+			*/
+			void	addIgnoredFile(fs::path const& file)						noexcept;
+
+			/**
+			*	@brief Remove all the ignored directories and files from the filter.
+			*/
+			void	clear()														noexcept;
+
+			/**
+			*	@brief Check whether a directory is ignored, i.e. it or one of its parent directories is ignored.
+			*
+			*	@param directory Absolute normalized path to the directory.
+			*
+			*	@return true if the directory is ignored, else false.
+			*/
+			bool	isIgnoredDirectory(fs::path const& directory)		const	noexcept;
+
+			/**
+			*	@brief Check whether a file is ignored, i.e. it or one of its parent directories is ignored.
+			*
+			*	@param file Absolute normalized path to the file.
+			*
+			*	@return true if the file is ignored, else false.
+			*/
+			bool	isIgnoredFile(fs::path const& file)					const	noexcept;
+	};
+}
\ No newline at end of file
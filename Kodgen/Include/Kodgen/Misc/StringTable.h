@@ -0,0 +1,96 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>	//std::unique_ptr
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace kodgen
+{
+	/**
+	*	Thread-safe table of interned strings: each distinct string is stored once, and interning the same content
+	*	returns the same entry as long as the string is referenced by an InternedString handle.
+	*	Entries are reference counted by the handles, and unreferenced entries are released by removeUnreferencedStrings.
+	*	The table is split in independently locked shards so that concurrent parsers rarely wait on each other.
+	*/
+	class StringTable
+	{
+		private:
+			/** Number of independently locked shards. */
+			static constexpr size_t	_shardCount = 16u;
+
+			struct Entry
+			{
+				/** Interned string. */
+				std::string			string;
+
+				/** Number of InternedString handles referring to this entry. */
+				std::atomic<size_t>	referenceCount	= 0u;
+			};
+
+			struct Shard
+			{
+				/** Mutex protecting the shard content. */
+				std::mutex													mutex;
+
+				/** Interned entries, by content. Keys view the string of their entry, which is never relocated. */
+				std::unordered_map<std::string_view, std::unique_ptr<Entry>>	entries;
+			};
+
+			/** Shards of the table, selected by the hash of the interned string. */
+			std::array<Shard, _shardCount>	_shards;
+
+			StringTable()	= default;
+
+			/**
+			*	@brief Intern a string and add a reference to its entry.
+			*
+			*	@param string Content of the string to intern.
+			*
+			*	@return The entry of the interned string, valid until its last reference is released.
+			*/
+			Entry&	intern(std::string_view string)	noexcept;
+
+		public:
+			StringTable(StringTable const&)	= delete;
+			StringTable(StringTable&&)		= delete;
+			~StringTable()					= default;
+
+			/**
+			*	@brief Get the program-wide string table.
+			*
+			*	@return The string table instance.
+			*/
+			static StringTable&	getInstance()				noexcept;
+
+			/**
+			*	@brief	Release the strings which are not referenced by any InternedString anymore.
+			*			Should be called between generation passes, once the parsing results of the pass are destroyed.
+			*
+			*	@return The number of released strings.
+			*/
+			size_t				removeUnreferencedStrings()	noexcept;
+
+			/**
+			*	@brief Count the number of distinct interned strings.
+			*
+			*	@return The number of distinct interned strings.
+			*/
+			size_t				getSize()					noexcept;
+
+			StringTable& operator=(StringTable const&)	= delete;
+			StringTable& operator=(StringTable&&)		= delete;
+
+			friend class InternedString;
+	};
+}
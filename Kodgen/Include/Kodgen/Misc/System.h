@@ -9,6 +9,8 @@
 
 #include <string>
 
+#include "Kodgen/Misc/Filesystem.h"
+
 namespace kodgen
 {
 	class System
@@ -24,6 +26,25 @@ namespace kodgen
 			*	
 			*	@return The result of the given command.
 			*/
-			static std::string executeCommand(std::string const& cmd);
+			static std::string	executeCommand(std::string const& cmd);
+
+			/**
+			*	@brief	Locate an executable the same way the shell would, by searching the PATH environment variable.
+			*			On Unix, files which are not executable by the current user are skipped.
+			*
+			*	@param exeName Name of the executable. If it contains a directory, it is checked directly.
+			*
+			*	@return The canonical path of the executable if it was found, else an empty path.
+			*/
+			static fs::path		findExecutable(std::string const& exeName)	noexcept;
+
+			/**
+			*	@brief	Get the Kodgen directory of the current user cache, creating it if necessary.
+			*			It is located in XDG_CACHE_HOME (or ~/.cache) on Unix and in LOCALAPPDATA on Windows,
+			*			and is only accessible by its owner.
+			*
+			*	@return The path of the cache directory, or an empty path if it could not be created.
+			*/
+			static fs::path		getUserCacheDirectory()						noexcept;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	//Forward declaration
+	class ILogger;
+
+	/**
+	*	Compilation flags of each file of a project, loaded from a compile_commands.json file.
+	*	Only the flags affecting the parsing (include directories, macro definitions and forced includes) are kept.
+	*	Files compiled with identical flags share the same argument set, so the number of argument sets
+	*	is usually close to the number of targets of the project.
+	*/
+	class CompilationDatabase
+	{
+		private:
+			/** Flags of each distinct target of the database. */
+			std::vector<std::vector<std::string>>							_argumentSets;
+
+			/** Index in _argumentSets of each argument set, keyed by its arguments joined with null characters. */
+			std::unordered_map<std::string, size_t>							_argumentSetIndices;
+
+			/** Index in _argumentSets of the flags of each source file of the database. */
+			std::unordered_map<fs::path, size_t, PathHash>					_sourceFileArgumentSets;
+
+			/** Source files of the database grouped by directory, used to find the target owning a header. */
+			std::unordered_map<fs::path, std::vector<fs::path>, PathHash>	_directorySourceFiles;
+
+			/**
+			*	@brief	Extract the flags relevant to the parsing from a compile command.
+			*			Relative paths are made absolute using the command working directory.
+			*
+			*	@param commandArguments	All arguments of the compile command, the compiler excluded.
+			*	@param workingDirectory	Directory the compile command is run from.
+			*
+			*	@return The flags relevant to the parsing, as they should be passed to libclang.
+			*/
+			static std::vector<std::string>	filterArguments(std::vector<std::string> const&	commandArguments,
+															fs::path const&					workingDirectory)	noexcept;
+
+			/**
+			*	@brief Get the index of an argument set, adding it to _argumentSets if no identical argument set exists yet.
+			*
+			*	@param arguments Flags of a compile command.
+			*
+			*	@return The index of the argument set in _argumentSets.
+			*/
+			size_t							addArgumentSet(std::vector<std::string>&& arguments)				noexcept;
+
+		public:
+			/**
+			*	@brief	Load the compilation database from a compile_commands.json file.
+			*			Previously loaded content is discarded.
+			*
+			*	@param compilationDatabasePath	Path to the compile_commands.json file or to the directory containing it.
+			*	@param logger					Optional logger used to issue logs in case of error. Can be nullptr.
+			*
+			*	@return true if the database has been loaded successfully, else false.
+			*/
+			bool										load(fs::path const&	compilationDatabasePath,
+															 ILogger*			logger)					noexcept;
+
+			/**
+			*	@brief Discard all loaded compile commands.
+			*/
+			void										clear()											noexcept;
+
+			/**
+			*	@brief	Find the flags a file is compiled with.
+			*			Source files use their own compile command. Headers use the flags of the source file owning them:
+			*			the source file with the same name in the same directory if any, else any source file of the closest parent directory.
+			*
+			*	@param file Path to the file.
+			*
+			*	@return The index of the argument set of the file, or getArgumentSets().size() if the database doesn't know the file.
+			*/
+			size_t										findArgumentSetIndex(fs::path const& file)		const	noexcept;
+
+			/**
+			*	@brief Getter for _argumentSets field.
+			*
+			*	@return _argumentSets.
+			*/
+			std::vector<std::vector<std::string>> const&	getArgumentSets()							const	noexcept;
+	};
+}
\ No newline at end of file
@@ -17,13 +17,20 @@
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
 #include "Kodgen/Parsing/ParsingSettings.h"
 #include "Kodgen/Parsing/PropertyParser.h"
+#include "Kodgen/Parsing/TranslationUnitCache.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/ILogger.h"
 
 namespace kodgen
 {
+	//Forward declaration
+	class CodeGenManager;
+
 	class FileParser : public NamespaceParser
 	{
+		//CodeGenManager calls preParse/postParse around the parsing results it loads from its cache.
+		friend CodeGenManager;
+
 		private:
 			/** Index used internally by libclang to process a translation unit. */
 			CXIndex								_clangIndex;
@@ -47,6 +54,19 @@ namespace kodgen
 														  CXCursor		parentCursor,
 														  CXClientData	clientData)						noexcept;
 
+			/**
+			*	@brief This method is called for each file included by the translation unit being parsed.
+			*
+			*	@param includedFile		The included file.
+			*	@param inclusionStack	Stack of inclusion locations, from the direct includer up to the main file.
+			*	@param inclusionDepth	Number of locations in the inclusion stack. 0 for the main file.
+			*	@param clientData		Pointer to a data provided by the client. Must contain a FileParser*.
+			*/
+			static void					collectIncludedFile(CXFile				includedFile,
+															CXSourceLocation*	inclusionStack,
+															unsigned int		inclusionDepth,
+															CXClientData		clientData)				noexcept;
+
 			/**
 			*	@brief Push a new clean context to prepare translation unit parsing.
 			*
@@ -118,7 +138,8 @@ namespace kodgen
 
 		protected:
 			/**
-			*	@brief Overridable method called just before starting the parsing process of a file
+			*	@brief	Overridable method called just before starting the parsing process of a file
+			*			Also called when the CodeGenManager loads the file parsing result from its cache instead of parsing the file.
 			*
 			*	@param parseFile Path to the file which is about to be parsed
 			*/
@@ -127,6 +148,7 @@ namespace kodgen
 			/**
 			*	@brief Overridable method called just after the parsing process has been finished
 			*	@brief Even if the parsing process ended prematurely, this method is called
+			*	@brief Also called when the CodeGenManager loads the file parsing result from its cache instead of parsing the file
 			*
 			*	@param parseFile Path to the file which has been parsed
 			*	@param result Result of the parsing
@@ -135,7 +157,13 @@ namespace kodgen
 
 		public:
 			/** Logger used to issue logs from the FileParser. Can be nullptr. */
-			ILogger*			logger	= nullptr;
+			ILogger*				logger					= nullptr;
+
+			/**
+			*	Cache keeping translation units alive between parsings of a same file. Can be nullptr.
+			*	If nullptr, each file is parsed from scratch and its translation unit is disposed right after parsing.
+			*/
+			TranslationUnitCache*	translationUnitCache	= nullptr;
 
 			FileParser()					noexcept;
 			FileParser(FileParser const&)	noexcept;
@@ -0,0 +1,285 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <type_traits>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/EAccessSpecifier.h"
+#include "Kodgen/InfoStructures/EEntityType.h"
+#include "Kodgen/InfoStructures/ETemplateParameterKind.h"
+#include "Kodgen/InfoStructures/TypeDescriptor.h"
+#include "Kodgen/Properties/EPropertyArgumentType.h"
+
+namespace kodgen
+{
+	/**
+	*	Layout of a serialized FileParsingResult, written by ParsingResultWriter and read in place by ParsedFileView.
+	*
+	*	The data starts with a Header followed by sections, each one being a flat array of records (or of characters for StringData).
+	*	Sections are aligned on 8 bytes so that a buffer aligned on 8 bytes (a memory mapped file for example) can be read without any copy.
+	*	Records never contain pointers: they reference each other and the strings by index, invalidIndex meaning none.
+	*	Values are stored with the endianness of the writing platform, and all padding bytes are explicit and written as 0.
+	*
+	*	Entities are stored in depth-first order, so all the entities nested in an entity are stored right after it,
+	*	until its subtreeEnd index. File level entities are stored in the order namespaces, classes, structs, enums, functions, variables,
+	*	and nested entities in the order of the member vectors of their outer entity.
+	*/
+	class ParsedFileFormat
+	{
+		public:
+			/** Index used by records to reference nothing. */
+			static constexpr uint32	invalidIndex	= static_cast<uint32>(-1);
+
+			/** Magic bytes at the beginning of the data. */
+			static constexpr char	magic[4]		= { 'K', 'P', 'R', 'F' };
+
+			/** Version of the format, incremented each time the layout of any record changes. */
+			static constexpr uint32	version			= 2u;
+
+			enum class ESection : uint32
+			{
+				/** uint32 offsets of each string in StringData. String i spans [offset i, offset i + 1[, so there is 1 offset more than strings. */
+				StringOffsets = 0u,
+
+				/** Characters of all the strings, without null terminators. */
+				StringData,
+
+				/** EntityRecord array. */
+				Entities,
+
+				/** TypeRecord array. */
+				Types,
+
+				/** TemplateParamRecord array. */
+				TemplateParams,
+
+				/** TypePart array. */
+				TypeParts,
+
+				/** PropertyRecord array. */
+				Properties,
+
+				/** uint32 array of the string index of each property argument. */
+				PropertyArguments,
+
+				/** TypedArgumentRecord array. */
+				TypedArguments,
+
+				/** ParentRecord array. */
+				Parents,
+
+				/** FunctionParamRecord array. */
+				FunctionParams,
+
+				/** uint32 array of the string index of each included file. */
+				IncludedFiles,
+
+				/** uint32 array of the string index of the name of each StructClassTree node. */
+				StructClassTreeNodes,
+
+				/** StructClassTreeLinkRecord array. */
+				StructClassTreeLinks,
+
+				Count
+			};
+
+			enum class EEntityFlags : uint32
+			{
+				None					= 0u,
+				IsFinal					= 1u << 0,		//Struct/class or method
+				IsForwardDeclaration	= 1u << 1,		//Struct/class
+				IsImportExport			= 1u << 2,		//Struct/class
+				IsStatic				= 1u << 3,		//Variable, field, function or method
+				IsInline				= 1u << 4,		//Function or method
+				IsMutable				= 1u << 5,		//Field
+				IsDefault				= 1u << 6,		//Method
+				IsVirtual				= 1u << 7,		//Method
+				IsPureVirtual			= 1u << 8,		//Method
+				IsOverride				= 1u << 9,		//Method
+				IsConst					= 1u << 10		//Method
+			};
+
+			struct Section
+			{
+				/** Offset of the section from the beginning of the data, in bytes. */
+				uint64	offset;
+
+				/** Size of the section, in bytes. */
+				uint64	size;
+			};
+
+			struct Header
+			{
+				char	magic[4];
+				uint32	version;
+
+				/** String index of the path to the parsed file. */
+				uint32	parsedFile;
+				uint32	padding;
+
+				Section	sections[static_cast<uint32>(ESection::Count)];
+			};
+
+			struct EntityRecord
+			{
+				EEntityType			entityType;
+
+				/** Access specifier of a nested struct/class, nested enum, field or method. */
+				EAccessSpecifier	accessSpecifier;
+				uint8				padding;
+
+				/** Combination of EEntityFlags. */
+				uint32				flags;
+
+				/** String indices of the name and the id of the entity. */
+				uint32				name;
+				uint32				id;
+
+				/** Index of the outer entity, invalidIndex for file level entities. */
+				uint32				outerEntity;
+
+				/** Index following the last entity nested (directly or not) in this entity. */
+				uint32				subtreeEnd;
+
+				/** Range of the properties of the entity in the Properties section. */
+				uint32				firstProperty;
+				uint32				propertyCount;
+
+				/** Type index of the struct/class/enum type, of the variable/field type, or of the function/method return type. */
+				uint32				type;
+
+				/** Type index of the enum underlying type. */
+				uint32				underlyingType;
+
+				/** String index of the function/method prototype. */
+				uint32				prototype;
+
+				/** Range of the struct/class parents in the Parents section. */
+				uint32				firstParent;
+				uint32				parentCount;
+
+				/** Range of the function/method parameters in the FunctionParams section. */
+				uint32				firstParameter;
+				uint32				parameterCount;
+				uint32				endPadding;
+
+				/** Value of an enum value, or memory offset of a field. */
+				int64				value;
+
+				/**
+				*	@brief Check whether a flag is set on this entity.
+				*
+				*	@param flag The flag to check.
+				*
+				*	@return true if the flag is set, else false.
+				*/
+				inline bool	hasFlag(EEntityFlags flag)	const	noexcept
+				{
+					return (flags & static_cast<uint32>(flag)) != 0u;
+				}
+			};
+
+			struct TypeRecord
+			{
+				/** String indices of the full name and the canonical full name of the type. */
+				uint32	fullName;
+				uint32	canonicalFullName;
+
+				/** Range of the template parameters in the TemplateParams section. */
+				uint32	firstTemplateParam;
+				uint32	templateParamCount;
+
+				/** Range of the type parts in the TypeParts section. */
+				uint32	firstTypePart;
+				uint32	typePartCount;
+
+				uint64	sizeInBytes;
+			};
+
+			struct TemplateParamRecord
+			{
+				/** String index of the parameter name. */
+				uint32					name;
+
+				/** Type index of the parameter type, invalidIndex if none. Always greater than the index of the type owning the parameter. */
+				uint32					type;
+
+				ETemplateParameterKind	kind;
+				uint8					padding[7];
+			};
+
+			struct PropertyRecord
+			{
+				/** String index of the property name. */
+				uint32	name;
+
+				/** Range of the arguments in the PropertyArguments section. */
+				uint32	firstArgument;
+				uint32	argumentCount;
+
+				/** Range of the typed arguments in the TypedArguments section. */
+				uint32	firstTypedArgument;
+				uint32	typedArgumentCount;
+			};
+
+			struct TypedArgumentRecord
+			{
+				EPropertyArgumentType	type;
+
+				/** Value of a Boolean argument, 0 or 1. Stored as an integer since any byte value must be safe to read. */
+				uint8					booleanValue;
+				uint8					padding[2];
+
+				/** String index of a String or Identifier argument value. */
+				uint32					stringValue;
+
+				int64					integerValue;
+				double					floatingPointValue;
+
+				/** Range of the elements of a List argument in the TypedArguments section. Always after this record. */
+				uint32					firstListElement;
+				uint32					listElementCount;
+			};
+
+			struct ParentRecord
+			{
+				/** Type index of the parent. */
+				uint32				type;
+
+				EAccessSpecifier	inheritanceAccess;
+				uint8				padding[3];
+			};
+
+			struct FunctionParamRecord
+			{
+				/** Type index and string index of the name of the parameter. */
+				uint32	type;
+				uint32	name;
+			};
+
+			struct StructClassTreeLinkRecord
+			{
+				/** StructClassTree node indices of the child and of the inherited struct/class. */
+				uint32				child;
+				uint32				parent;
+
+				EAccessSpecifier	inheritanceAccess;
+				uint8				padding[7];
+			};
+
+			/** Alignment of every section. */
+			static constexpr uint64	sectionAlignment	= 8u;
+
+			static_assert(std::is_trivially_copyable_v<EntityRecord> && alignof(EntityRecord) <= sectionAlignment);
+			static_assert(sizeof(EntityRecord) == 72u, "EntityRecord must not contain implicit padding.");
+			static_assert(std::is_trivially_copyable_v<TypeRecord> && alignof(TypeRecord) <= sectionAlignment);
+			static_assert(std::is_trivially_copyable_v<TypedArgumentRecord> && alignof(TypedArgumentRecord) <= sectionAlignment);
+			static_assert(sizeof(Header) % sectionAlignment == 0u);
+	};
+}
@@ -0,0 +1,139 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string_view>
+#include <cassert>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Parsing/ParsedFileFormat.h"
+
+namespace kodgen
+{
+	/**
+	*	Zero-copy reader of a FileParsingResult serialized in the ParsedFileFormat.
+	*	Records are read in place from the provided buffer, which must outlive the view. Nothing is allocated.
+	*	All the indices and ranges of the records are checked once when the view is constructed, so that a valid view can
+	*	be traversed without any further check, even if the buffer comes from another process or from disk.
+	*	This class doesn't depend on libclang, so tools consuming parsed files don't have to link it.
+	*/
+	class ParsedFileView
+	{
+		public:
+			/**
+			*	Read-only view on a contiguous array of records.
+			*/
+			template <typename T>
+			class ArrayView
+			{
+				private:
+					/** First element of the array. */
+					T const*	_data	= nullptr;
+
+					/** Number of elements in the array. */
+					uint32		_size	= 0u;
+
+				public:
+					ArrayView()									= default;
+					ArrayView(T const* data, uint32 size)		noexcept;
+
+					T const&	operator[](uint32 index)	const	noexcept;
+
+					T const*	begin()						const	noexcept;
+					T const*	end()						const	noexcept;
+					uint32		size()						const	noexcept;
+					bool		empty()						const	noexcept;
+			};
+
+		private:
+			/** Header of the data, nullptr if the data is invalid. */
+			ParsedFileFormat::Header const*							_header			= nullptr;
+
+			/** Characters of all the strings. */
+			char const*												_stringData		= nullptr;
+
+			ArrayView<uint32>										_stringOffsets;
+			ArrayView<ParsedFileFormat::EntityRecord>				_entities;
+			ArrayView<ParsedFileFormat::TypeRecord>					_types;
+			ArrayView<ParsedFileFormat::TemplateParamRecord>		_templateParams;
+			ArrayView<TypePart>										_typeParts;
+			ArrayView<ParsedFileFormat::PropertyRecord>				_properties;
+			ArrayView<uint32>										_propertyArguments;
+			ArrayView<ParsedFileFormat::TypedArgumentRecord>		_typedArguments;
+			ArrayView<ParsedFileFormat::ParentRecord>				_parents;
+			ArrayView<ParsedFileFormat::FunctionParamRecord>		_functionParams;
+			ArrayView<uint32>										_includedFiles;
+			ArrayView<uint32>										_structClassTreeNodes;
+			ArrayView<ParsedFileFormat::StructClassTreeLinkRecord>	_structClassTreeLinks;
+
+			/**
+			*	@brief Get a section of the data as an array of records.
+			*
+			*	@param data			The whole data.
+			*	@param section		The section to get.
+			*	@param out_array	View on the records of the section.
+			*
+			*	@return true if the section lies in the data and is correctly aligned, else false.
+			*/
+			template <typename T>
+			bool	initSection(std::string_view				data,
+								ParsedFileFormat::ESection		section,
+								ArrayView<T>&					out_array)		const	noexcept;
+
+			/**
+			*	@brief Check that all the string indices, record indices and ranges of the data are in bounds.
+			*
+			*	@param stringDataSize Size of the StringData section.
+			*
+			*	@return true if the data can be traversed safely, else false.
+			*/
+			bool	validate(uint64 stringDataSize)									const	noexcept;
+
+		public:
+			ParsedFileView()							= default;
+			ParsedFileView(std::string_view data)		noexcept;
+
+			/**
+			*	@return true if the data is a complete parsed file of the current format version, else false.
+			*			Accessors must not be used on an invalid view.
+			*/
+			bool			isValid()																			const	noexcept;
+
+			/**
+			*	@brief Get a string of the string table.
+			*
+			*	@param index Index of the string.
+			*
+			*	@return The string, or an empty string if index is ParsedFileFormat::invalidIndex.
+			*/
+			std::string_view	getString(uint32 index)															const	noexcept;
+
+			/**
+			*	@return The path to the parsed file.
+			*/
+			std::string_view	getParsedFile()																	const	noexcept;
+
+			/**
+			*	Getters for the record arrays of each section. See ParsedFileFormat for the meaning of each array.
+			*/
+			ArrayView<ParsedFileFormat::EntityRecord> const&				getEntities()						const	noexcept;
+			ArrayView<ParsedFileFormat::TypeRecord> const&					getTypes()							const	noexcept;
+			ArrayView<ParsedFileFormat::TemplateParamRecord> const&			getTemplateParams()					const	noexcept;
+			ArrayView<TypePart> const&										getTypeParts()						const	noexcept;
+			ArrayView<ParsedFileFormat::PropertyRecord> const&				getProperties()						const	noexcept;
+			ArrayView<uint32> const&										getPropertyArguments()				const	noexcept;
+			ArrayView<ParsedFileFormat::TypedArgumentRecord> const&			getTypedArguments()					const	noexcept;
+			ArrayView<ParsedFileFormat::ParentRecord> const&				getParents()						const	noexcept;
+			ArrayView<ParsedFileFormat::FunctionParamRecord> const&			getFunctionParams()					const	noexcept;
+			ArrayView<uint32> const&										getIncludedFiles()					const	noexcept;
+			ArrayView<uint32> const&										getStructClassTreeNodes()			const	noexcept;
+			ArrayView<ParsedFileFormat::StructClassTreeLinkRecord> const&	getStructClassTreeLinks()			const	noexcept;
+	};
+
+	#include "Kodgen/Parsing/ParsedFileView.inl"
+}
@@ -0,0 +1,64 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+ParsedFileView::ArrayView<T>::ArrayView(T const* data, uint32 size) noexcept:
+	_data{data},
+	_size{size}
+{
+}
+
+template <typename T>
+T const& ParsedFileView::ArrayView<T>::operator[](uint32 index) const noexcept
+{
+	assert(index < _size);
+
+	return _data[index];
+}
+
+template <typename T>
+T const* ParsedFileView::ArrayView<T>::begin() const noexcept
+{
+	return _data;
+}
+
+template <typename T>
+T const* ParsedFileView::ArrayView<T>::end() const noexcept
+{
+	return _data + _size;
+}
+
+template <typename T>
+uint32 ParsedFileView::ArrayView<T>::size() const noexcept
+{
+	return _size;
+}
+
+template <typename T>
+bool ParsedFileView::ArrayView<T>::empty() const noexcept
+{
+	return _size == 0u;
+}
+
+template <typename T>
+bool ParsedFileView::initSection(std::string_view data, ParsedFileFormat::ESection section, ArrayView<T>& out_array) const noexcept
+{
+	ParsedFileFormat::Section const& sectionInfo = _header->sections[static_cast<uint32>(section)];
+
+	if (sectionInfo.offset % ParsedFileFormat::sectionAlignment != 0u ||
+		sectionInfo.offset > data.size() ||
+		sectionInfo.size > data.size() - sectionInfo.offset ||
+		sectionInfo.size % sizeof(T) != 0u ||
+		sectionInfo.size / sizeof(T) >= ParsedFileFormat::invalidIndex)
+	{
+		return false;
+	}
+
+	out_array = ArrayView<T>(reinterpret_cast<T const*>(data.data() + sectionInfo.offset), static_cast<uint32>(sectionInfo.size / sizeof(T)));
+
+	return true;
+}
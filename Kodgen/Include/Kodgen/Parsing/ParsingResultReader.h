@@ -0,0 +1,89 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Parsing/ParsedFileView.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+
+namespace kodgen
+{
+	/**
+	*	Rebuild a FileParsingResult from data written by a ParsingResultWriter.
+	*	The data is validated by a ParsedFileView, so truncated or corrupted data makes the read fail instead of reading out of the buffer.
+	*	Tools which only need to inspect the parsed entities should use a ParsedFileView directly instead, which doesn't allocate anything.
+	*/
+	class ParsingResultReader
+	{
+		private:
+			/** Copy of the data, only used when the provided data is not aligned as ParsedFileView requires. */
+			std::vector<uint64>	_alignedData;
+
+			/** View on the serialized data. */
+			ParsedFileView		_view;
+
+			/** Did all reads succeed so far? */
+			bool				_isValid		= true;
+
+			/**
+			*	@brief	Read all the entities of a range which can be nested in a namespace (or in a file), in the vectors of the container.
+			*			The reader becomes invalid if an entity of the range can't be nested in a namespace.
+			*
+			*	@param firstEntity		Index of the first entity of the range.
+			*	@param subtreeEnd		Index following the last entity of the range.
+			*	@param out_container	NamespaceInfo or FileParsingResult the entities are appended to.
+			*/
+			template <typename T>
+			void	readNamespaceMembers(uint32	firstEntity,
+										 uint32	subtreeEnd,
+										 T&		out_container)										noexcept;
+
+			/**
+			*	Methods reading an info structure from the records of the view.
+			*	outerEntity pointers are left to nullptr and must be refreshed once the whole result is read.
+			*/
+			void	readProperty(ParsedFileFormat::PropertyRecord const& record, Property& out_property)	noexcept;
+			void	readTypedArgument(uint32 argumentIndex, PropertyArgument& out_argument)					noexcept;
+			void	readType(uint32 typeIndex, TypeInfo& out_type)											noexcept;
+			void	readEntity(uint32 entityIndex, EntityInfo& out_entity)									noexcept;
+			void	readNamespace(uint32 entityIndex, NamespaceInfo& out_namespace)							noexcept;
+			void	readStructClass(uint32 entityIndex, StructClassInfo& out_structClass)					noexcept;
+			void	readEnum(uint32 entityIndex, EnumInfo& out_enum)										noexcept;
+			void	readEnumValue(uint32 entityIndex, EnumValueInfo& out_enumValue)							noexcept;
+			void	readVariable(uint32 entityIndex, VariableInfo& out_variable)							noexcept;
+			void	readField(uint32 entityIndex, FieldInfo& out_field)										noexcept;
+			void	readFunction(uint32 entityIndex, FunctionInfo& out_function)							noexcept;
+			void	readMethod(uint32 entityIndex, MethodInfo& out_method)									noexcept;
+			void	readStructClassTree(StructClassTree& out_structClassTree)								noexcept;
+
+			/**
+			*	@brief Refresh the outerEntity field of all the entities of a parsing result.
+			*
+			*	@param out_result The parsing result to refresh.
+			*/
+			static void	refreshOuterEntity(FileParsingResult& out_result)					noexcept;
+
+		public:
+			ParsingResultReader(std::string_view data)	noexcept;
+
+			/**
+			*	@brief Read a parsing result.
+			*
+			*	@param out_result Parsing result filled with the read data. It should be empty when this method is called.
+			*
+			*	@return true if a complete parsing result with the current format version was read, else false.
+			*			If false is returned, out_result content is unspecified.
+			*/
+			bool	read(FileParsingResult& out_result)	noexcept;
+	};
+
+	#include "Kodgen/Parsing/ParsingResultReader.inl"
+}
@@ -0,0 +1,46 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+void ParsingResultReader::readNamespaceMembers(uint32 firstEntity, uint32 subtreeEnd, T& out_container) noexcept
+{
+	ParsedFileView::ArrayView<ParsedFileFormat::EntityRecord> const& entities = _view.getEntities();
+
+	for (uint32 entityIndex = firstEntity; entityIndex < subtreeEnd && _isValid; entityIndex = entities[entityIndex].subtreeEnd)
+	{
+		switch (entities[entityIndex].entityType)
+		{
+			case EEntityType::Namespace:
+				readNamespace(entityIndex, out_container.namespaces.emplace_back());
+				break;
+
+			case EEntityType::Struct:
+				readStructClass(entityIndex, out_container.structs.emplace_back());
+				break;
+
+			case EEntityType::Class:
+				readStructClass(entityIndex, out_container.classes.emplace_back());
+				break;
+
+			case EEntityType::Enum:
+				readEnum(entityIndex, out_container.enums.emplace_back());
+				break;
+
+			case EEntityType::Function:
+				readFunction(entityIndex, out_container.functions.emplace_back());
+				break;
+
+			case EEntityType::Variable:
+				readVariable(entityIndex, out_container.variables.emplace_back());
+				break;
+
+			default:
+				_isValid = false;
+				break;
+		}
+	}
+}
@@ -0,0 +1,152 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Parsing/ParsedFileFormat.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+
+namespace kodgen
+{
+	/**
+	*	Serialize a FileParsingResult to the ParsedFileFormat, which can be read in place by a ParsedFileView
+	*	or turned back into a FileParsingResult by a ParsingResultReader.
+	*	Parsing errors are not serialized: only successful parsing results are meant to be serialized.
+	*/
+	class ParsingResultWriter
+	{
+		private:
+			/** Buffer the parsing result is written to. */
+			std::string											_data;
+
+			/** Index of each string already added to the string table, so that each string is stored once. */
+			std::unordered_map<std::string, uint32>				_stringIndices;
+
+			/** Records of each section, written to _data once the whole parsing result is added. */
+			std::vector<uint32>									_stringOffsets;
+			std::string											_stringData;
+			std::vector<ParsedFileFormat::EntityRecord>			_entities;
+			std::vector<ParsedFileFormat::TypeRecord>			_types;
+			std::vector<ParsedFileFormat::TemplateParamRecord>	_templateParams;
+			std::vector<TypePart>								_typeParts;
+			std::vector<ParsedFileFormat::PropertyRecord>		_properties;
+			std::vector<uint32>									_propertyArguments;
+			std::vector<ParsedFileFormat::TypedArgumentRecord>	_typedArguments;
+			std::vector<ParsedFileFormat::ParentRecord>			_parents;
+			std::vector<ParsedFileFormat::FunctionParamRecord>	_functionParams;
+			std::vector<uint32>									_includedFiles;
+			std::vector<uint32>									_structClassTreeNodes;
+			std::vector<ParsedFileFormat::StructClassTreeLinkRecord>	_structClassTreeLinks;
+
+			/**
+			*	@brief Clear all the records added by a previous write.
+			*/
+			void	clear()																		noexcept;
+
+			/**
+			*	@brief Add a string to the string table if it is not in it yet.
+			*
+			*	@param string The string to add.
+			*
+			*	@return The index of the string.
+			*/
+			uint32	addString(std::string_view string)											noexcept;
+
+			/**
+			*	@brief Add a type and its template parameters.
+			*
+			*	@param type The type to add.
+			*
+			*	@return The index of the type.
+			*/
+			uint32	addType(TypeInfo const& type)												noexcept;
+
+			/**
+			*	@brief Add a contiguous range of typed property arguments, followed by the elements of their lists.
+			*
+			*	@param arguments The arguments to add.
+			*
+			*	@return The index of the first argument.
+			*/
+			uint32	addTypedArguments(std::vector<PropertyArgument> const& arguments)			noexcept;
+
+			/**
+			*	@brief Add the record of an entity with its name, id and properties. Nested entities must be added right after.
+			*
+			*	@param entity			The entity to add.
+			*	@param outerEntity		Index of the outer entity record.
+			*	@param accessSpecifier	Access specifier of the entity in its outer entity, if any.
+			*
+			*	@return The index of the entity record.
+			*/
+			uint32	addEntity(EntityInfo const&	entity,
+							  uint32			outerEntity,
+							  EAccessSpecifier	accessSpecifier = EAccessSpecifier::Invalid)	noexcept;
+
+			/**
+			*	@brief Set the subtreeEnd of an entity record once all its nested entities are added.
+			*
+			*	@param entityIndex Index of the entity record.
+			*/
+			void	closeEntity(uint32 entityIndex)												noexcept;
+
+			/**
+			*	Methods adding an entity record followed by the records of all its nested entities.
+			*/
+			void	addNamespace(NamespaceInfo const& namespaceInfo, uint32 outerEntity)									noexcept;
+			void	addStructClass(StructClassInfo const& structClass, uint32 outerEntity, EAccessSpecifier accessSpecifier)	noexcept;
+			void	addEnum(EnumInfo const& enumInfo, uint32 outerEntity, EAccessSpecifier accessSpecifier)					noexcept;
+			void	addEnumValue(EnumValueInfo const& enumValue, uint32 outerEntity)										noexcept;
+			void	addVariable(VariableInfo const& variable, uint32 outerEntity)											noexcept;
+			void	addField(FieldInfo const& field, uint32 outerEntity)													noexcept;
+			void	addFunction(FunctionInfo const& function, uint32 outerEntity)											noexcept;
+			void	addMethod(MethodInfo const& method, uint32 outerEntity)													noexcept;
+
+			/**
+			*	@brief Add the nodes and inheritance links of a struct/class tree.
+			*
+			*	@param structClassTree The tree to add.
+			*/
+			void	addStructClassTree(StructClassTree const& structClassTree)					noexcept;
+
+			/**
+			*	@brief Append a section to _data, aligned on ParsedFileFormat::sectionAlignment.
+			*
+			*	@param section		The section to append.
+			*	@param records		The records of the section.
+			*	@param out_header	Header in which the offset and size of the section are set.
+			*/
+			template <typename Container>
+			void	writeSection(ParsedFileFormat::ESection		section,
+								 Container const&				records,
+								 ParsedFileFormat::Header&		out_header)							noexcept;
+
+		public:
+			/**
+			*	@brief Serialize a parsing result, replacing the data of any previous write.
+			*
+			*	@param result The parsing result to serialize. It should not contain any error.
+			*/
+			void				write(FileParsingResult const& result)		noexcept;
+
+			/**
+			*	@brief Getter for the _data field.
+			*
+			*	@return The serialized parsing result.
+			*/
+			std::string const&	getData()							const	noexcept;
+	};
+
+	#include "Kodgen/Parsing/ParsingResultWriter.inl"
+}
@@ -0,0 +1,22 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Container>
+void ParsingResultWriter::writeSection(ParsedFileFormat::ESection section, Container const& records, ParsedFileFormat::Header& out_header) noexcept
+{
+	using Record = typename Container::value_type;
+
+	static_assert(std::is_trivially_copyable_v<Record>, "Only trivially copyable records can be written directly.");
+
+	//Pad with zeros up to the section alignment
+	_data.resize((_data.size() + ParsedFileFormat::sectionAlignment - 1u) / ParsedFileFormat::sectionAlignment * ParsedFileFormat::sectionAlignment, '\0');
+
+	out_header.sections[static_cast<uint32>(section)].offset	= _data.size();
+	out_header.sections[static_cast<uint32>(section)].size		= records.size() * sizeof(Record);
+
+	_data.append(reinterpret_cast<char const*>(records.data()), records.size() * sizeof(Record));
+}
@@ -48,6 +48,9 @@ namespace kodgen
 			/** All variables contained directory under file level. */
 			std::vector<VariableInfo>		variables;
 
+			/** All files included directly or indirectly by the parsed file, system headers excluded. */
+			std::vector<fs::path>			includedFiles;
+
 			/** Structure containing the whole struct/class hierarchy linked to parsed structs/classes. */
 			StructClassTree					structClassTree;
 
@@ -9,8 +9,12 @@
 
 #include <unordered_set>
 #include <string>
+#include <vector>
+#include <memory>	//std::shared_ptr
+#include <mutex>
 
 #include "Kodgen/Properties/PropertyParsingSettings.h"
+#include "Kodgen/Parsing/CompilationDatabase.h"
 #include "Kodgen/Misc/Settings.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/Optional.h"
@@ -21,6 +25,25 @@ namespace kodgen
 	class ParsingSettings : public Settings
 	{
 		private:
+			/**
+			*	Precompiled prefix header of an argument set of the compilation database.
+			*	It is built on first use of the argument set, so that targets without any parsed file never pay for a PCH.
+			*/
+			struct TargetPrecompiledHeader
+			{
+				/** Mutex protecting all fields. */
+				std::mutex					mutex;
+
+				/** Has the PCH build been attempted? compilationArguments must not be read before. */
+				bool						isBuilt	= false;
+
+				/** Path to the PCH, empty if the precompilation failed. */
+				std::string					path;
+
+				/** Compilation arguments of the argument set, followed by the PCH arguments if the precompilation succeeded. */
+				std::vector<char const*>	compilationArguments;
+			};
+
 			/** Section name used in the toml file for FileGenerator settings. */
 			static constexpr char const*			_tomlSectionName				= "ParsingSettings";
 
@@ -38,6 +61,34 @@ namespace kodgen
 			*/
 			std::string								_compilerExeName				= "";
 
+			/**
+			*	Path to a prefix header, typically including the standard library and the heaviest common headers of the project.
+			*	If set, it is precompiled once when the settings are initialized and the resulting PCH is fed to every parsed translation unit,
+			*	so the headers it includes are not parsed again for each file. The PCH of each compilation database target is built on first use.
+			*/
+			fs::path								_prefixHeader;
+
+			/** Path to the precompiled prefix header used with _compilationArguments. Empty if no precompiled header is used. */
+			std::string								_precompiledHeaderPath;
+
+			/**
+			*	PCH of each entry of _targetCompilationArguments, empty if no prefix header is used.
+			*	The entries are shared by the copies of the settings, so that a PCH is built once for all of them.
+			*/
+			std::vector<std::shared_ptr<TargetPrecompiledHeader>>	_targetPrecompiledHeaders;
+
+			/** Logger used to report the precompilation failures of the target PCHs, which happen after init. */
+			ILogger*								_logger							= nullptr;
+
+			/**
+			*	Path to the compile_commands.json file of the project (or to the directory containing it).
+			*	If set, each parsed file additionally receives the include directories and macros of the target compiling it.
+			*/
+			fs::path								_compilationDatabasePath;
+
+			/** Compilation database loaded from _compilationDatabasePath. */
+			CompilationDatabase						_compilationDatabase;
+
 			/** Variables used to build compilation command line. */
 			std::string								_kodgenParsingMacro			= "-D" + parsingMacro;
 			std::string								_cppVersionCommandLine;
@@ -55,6 +106,12 @@ namespace kodgen
 
 			std::vector<char const*>				_compilationArguments;
 
+			/**
+			*	Compilation arguments of each argument set of _compilationDatabase: _compilationArguments completed with the target flags.
+			*	They don't contain the PCH arguments, which are added to the matching entry of _targetPrecompiledHeaders.
+			*/
+			std::vector<std::vector<char const*>>	_targetCompilationArguments;
+
 			/**
 			*	@brief Try to convert an integer to a ECppVersion enum value.
 			* 
@@ -78,6 +135,80 @@ namespace kodgen
 			*/
 			void	refreshCompilationArguments(ILogger* logger)							noexcept;
 
+			/**
+			*	@brief	Precompile the prefix header with the given compilation arguments and store the result in the user cache directory.
+			*			The PCH is named after a hash of the arguments, so a PCH built by a previous run is reused as long as none
+			*			of the files it was built from changed.
+			* 
+			*	@param compilationArguments			Arguments the PCH is built with. They must be the exact arguments of the translation units using it.
+			*	@param out_precompiledHeaderPath	Path to the PCH to use, or empty string if the precompilation failed.
+			*	@param logger						Optional logger used to issue logs in case of error. Can be nullptr.
+			* 
+			*	@return true if a PCH is available, else false.
+			*/
+			bool	buildPrecompiledHeader(std::vector<char const*> const&	compilationArguments,
+										   std::string&						out_precompiledHeaderPath,
+										   ILogger*							logger)				const	noexcept;
+
+			/**
+			*	@brief Check that a PCH exists and that none of the files listed in its inputs file changed since it was built.
+			* 
+			*	@param precompiledHeaderPath Path to the PCH.
+			* 
+			*	@return true if the PCH can be reused, else false.
+			*/
+			static bool	isPrecompiledHeaderUpToDate(fs::path const& precompiledHeaderPath)		noexcept;
+
+			/**
+			*	@brief Read the inputs file written next to a PCH when it was built.
+			* 
+			*	@param precompiledHeaderPath	Path to the PCH.
+			*	@param out_inputs				Last write time stamp (see getLastWriteTimeStamp) and path of each file the PCH was built from.
+			* 
+			*	@return true if the inputs file could be read, else false.
+			*/
+			static bool	readPrecompiledHeaderInputs(fs::path const&									precompiledHeaderPath,
+													std::vector<std::pair<std::string, fs::path>>&	out_inputs)	noexcept;
+
+			/**
+			*	@brief Get the last write time of a file as a string, to be compared with the stamps of the PCH inputs files.
+			* 
+			*	@param file Path to the file.
+			* 
+			*	@return The last write time of the file, or an empty string if it could not be read.
+			*/
+			static std::string	getLastWriteTimeStamp(fs::path const& file)					noexcept;
+
+			/**
+			*	@brief	Get the path of the PCH built with the given compilation arguments.
+			*			The path is a stable hash of the arguments, so a PCH built by a previous run is found again.
+			* 
+			*	@param compilationArguments Arguments the PCH is built with.
+			* 
+			*	@return The path of the PCH in the user cache directory, or an empty path if no user cache directory is available.
+			*/
+			fs::path	computePrecompiledHeaderPath(std::vector<char const*> const& compilationArguments)	const	noexcept;
+
+			/**
+			*	@brief	Get the compilation arguments of an argument set of the compilation database including its PCH arguments,
+			*			precompiling the prefix header with the argument set if it is the first use of the argument set.
+			*			This method can be called concurrently from multiple threads.
+			*
+			*	@param argumentSetIndex Index of the argument set in _targetCompilationArguments.
+			*
+			*	@return The compilation arguments of the argument set, without PCH arguments if the precompilation failed.
+			*/
+			std::vector<char const*> const&	getTargetPrecompiledHeaderArguments(size_t argumentSetIndex)	const	noexcept;
+
+			/**
+			*	@brief	Load the compilation database and build the compilation arguments of each of its argument sets.
+			*			Their PCHs are only built on first use (see getTargetPrecompiledHeaderArguments).
+			*			Must be called after _compilationArguments has been filled.
+			* 
+			*	@param logger Optional logger used to issue logs in case of error. Can be nullptr.
+			*/
+			void	refreshTargetCompilationArguments(ILogger* logger)						noexcept;
+
 			/**
 			*	@brief Load the cppVersion setting from toml.
 			* 
@@ -133,6 +264,24 @@ namespace kodgen
 			void	loadProjectIncludeDirectories(toml::value const&	parsingSettings,
 												  ILogger*				logger)				noexcept;
 
+			/**
+			*	@brief	Load the _prefixHeader setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadPrefixHeader(toml::value const&	parsingSettings,
+									 ILogger*			logger)								noexcept;
+
+			/**
+			*	@brief	Load the _compilationDatabasePath setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadCompilationDatabasePath(toml::value const&	parsingSettings,
+												ILogger*			logger)						noexcept;
+
 		protected:
 			virtual bool loadSettingsValues(toml::value const&	tomlData,
 											ILogger*			logger)		noexcept override;
@@ -234,6 +383,13 @@ namespace kodgen
 			*/
 			std::string const&								getCompilerExeName()								const	noexcept;
 
+			/**
+			*	@brief Getter for _prefixHeader field.
+			*	
+			*	@return _prefixHeader;
+			*/
+			fs::path const&									getPrefixHeader()									const	noexcept;
+
 			/**
 			*	@brief Getter for _compilationArguments.
 			* 
@@ -241,6 +397,41 @@ namespace kodgen
 			*/
 			std::vector<char const*> const&					getCompilationArguments()							const	noexcept;
 
+			/**
+			*	@brief	Get the arguments to use to parse a specific file.
+			*			Files known by the compilation database (directly or through the source file owning them) get the flags of their target.
+			*			Files compiled with the same flags share the same arguments vector.
+			*
+			*	@param file Sanitized path to the parsed file.
+			* 
+			*	@return The compilation arguments of the file, _compilationArguments if the file is unknown or no compilation database is used.
+			*/
+			std::vector<char const*> const&					getCompilationArguments(fs::path const& file)		const	noexcept;
+
+			/**
+			*	@brief	Getter for _targetCompilationArguments field.
+			*			The arguments don't contain the PCH arguments, since target PCHs are only built on first use.
+			*	
+			*	@return _targetCompilationArguments;
+			*/
+			std::vector<std::vector<char const*>> const&	getTargetCompilationArguments()						const	noexcept;
+
+			/**
+			*	@brief	Describe the files all the precompiled prefix headers are built from, with their current last write time.
+			*			Target PCHs are not built by this call: those not built yet are described by the inputs of their last build,
+			*			so the description only changes when one of the files they depend on changes.
+			*	
+			*	@return The description of the PCHs inputs, empty if no precompiled header is used.
+			*/
+			std::string										getPrecompiledHeaderInputsStamp()					const	noexcept;
+
+			/**
+			*	@brief Getter for _compilationDatabasePath field.
+			*	
+			*	@return _compilationDatabasePath;
+			*/
+			fs::path const&									getCompilationDatabasePath()						const	noexcept;
+
 			/**
 			*	@brief	Setter for _compilerExeName field.
 			*			This will also check that the compiler is indeed available on the running computer.
@@ -250,5 +441,27 @@ namespace kodgen
 			*	@return true if the compiler is valid on the running computer, else false.
 			*/
 			bool											setCompilerExeName(std::string const& compilerExeName)		noexcept;
+
+			/**
+			*	@brief	Setter for _prefixHeader field.
+			*			The prefix header is precompiled during the next init call and injected in all parsed translation units.
+			*			Provide an empty path to stop using a prefix header.
+			*	
+			*	@param prefixHeader Path to the prefix header.
+			*	
+			*	@return true if the prefix header has been updated, false if the provided path doesn't exist or is not a file.
+			*/
+			bool											setPrefixHeader(fs::path const& prefixHeader)				noexcept;
+
+			/**
+			*	@brief	Setter for _compilationDatabasePath field.
+			*			The compilation database is loaded during the next init call.
+			*			Provide an empty path to stop using a compilation database.
+			*	
+			*	@param compilationDatabasePath Path to the compile_commands.json file, or to the directory containing it.
+			*	
+			*	@return true if the path has been updated, false if no compile_commands.json could be found at the provided path.
+			*/
+			bool											setCompilationDatabasePath(fs::path const& compilationDatabasePath)	noexcept;
 	};
 }
\ No newline at end of file
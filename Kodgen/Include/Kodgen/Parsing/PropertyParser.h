@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <string_view>
+
 #include "Kodgen/InfoStructures/EntityInfo.h"
 #include "Kodgen/Properties/PropertyParsingSettings.h"
+#include "Kodgen/Properties/PropertyArgument.h"
 #include "Kodgen/Misc/Optional.h"
 
 namespace kodgen
@@ -22,9 +25,6 @@ namespace kodgen
 			/** Last parsing error which occured when parsing from this parser. */
 			std::string								_parsingErrorDescription	= "";
 
-			/** Collection of last parsed split properties. */
-			std::vector<std::vector<std::string>>	_splitProps;
-
 			/** Chars to take into consideration when parsing a property. */
 			std::string								_relevantCharsForPropParsing;
 
@@ -32,28 +32,46 @@ namespace kodgen
 			std::string								_relevantCharsForPropArgsParsing;
 
 			/**
-			*	@brief	Split properties and fill _splitProps on success.
+			*	@brief	Split properties and fill out_properties on success.
+			*			The string is traversed once and only the final property names and arguments are copied.
 			*			On failure, _parsingErrorDescription is updated.
 			*
-			*	@param propertiesString String containing the properties to split.
+			*	@param propertiesString	String containing the properties to split.
+			*	@param out_properties	List of properties to fill.
 			*
 			*	@return true on a successful split, else false.
 			*/
-			bool									splitProperties(std::string&& propertiesString)							noexcept;
+			bool									splitProperties(std::string_view		propertiesString,
+																	std::vector<Property>&	out_properties)				noexcept;
 
 			/**
-			*	@brief Remove all starting space characters.
+			*	@brief Remove all starting and trailing space characters.
 			*
 			*	@param toCleanString The string to clean.
+			*
+			*	@return A view to toCleanString without starting and trailing spaces.
 			*/
-			void									removeStartSpaces(std::string& toCleanString)					const	noexcept;
+			static std::string_view					trimSpaces(std::string_view toCleanString)								noexcept;
 
 			/**
-			*	@brief Remove all trailing space characters.
+			*	@brief	Find the end of the next argument: the first argument separator or argument end encloser
+			*			which is neither nested in argument enclosers nor part of a string literal.
+			*			Only used when typed arguments are parsed, so that untyped arguments are split as they always were.
 			*
-			*	@param toCleanString The string to clean.
+			*	@param arguments The string we are looking the end of the next argument in.
+			*
+			*	@return The index of the delimiter, or std::string_view::npos if there is none.
+			*/
+			size_t									findNextArgumentDelimiter(std::string_view arguments)			const	noexcept;
+
+			/**
+			*	@brief Convert an argument to its actual type.
+			*
+			*	@param argument The argument string, without starting and trailing spaces.
+			*
+			*	@return The typed argument.
 			*/
-			void									removeTrailSpaces(std::string& toCleanString)					const	noexcept;
+			PropertyArgument						parseTypedArgument(std::string_view argument)					const	noexcept;
 
 			/**
 			*	@brief	Search the next property.
@@ -61,11 +79,13 @@ namespace kodgen
 			*
 			*	@param inout_parsingProps		The string we are looking the next prop in.
 			*	@param out_isParsingArgument	Updated by this function call to indicate either the processed prop has following arguments or not.
+			*	@param out_properties			List of properties to update.
 			*
-			*	@return true & add the property to _splitProps (new vector) on success, else return false.
+			*	@return true & add the property to out_properties on success, else return false.
 			*/
-			bool									lookForNextProperty(std::string&	inout_parsingProps,
-																		bool&			out_isParsingArgument)				noexcept;
+			bool									lookForNextProperty(std::string_view&		inout_parsingProps,
+																		bool&					out_isParsingArgument,
+																		std::vector<Property>&	out_properties)			noexcept;
 
 			/**
 			*	@brief	Search the next property argument.
@@ -73,42 +93,25 @@ namespace kodgen
 			*
 			*	@param inout_parsingProps		The string we are looking the next prop in.
 			*	@param out_isParsingArgument	Filled by this function call to indicate either the processed prop has following arguments or not.
+			*	@param out_properties			List of properties to update.
 			*
-			*	@return true & add the argument to _splitProps (last added vector) on success, else return false.
-			*/
-			bool									lookForNextPropertyArgument(std::string&	inout_parsingProps,
-																				bool&			out_isParsingArgument)		noexcept;
-
-			/**
-			*	@brief	Create a list of properties based on the parsed properties
-			*	
-			*	@param splitProps The collection of all parsed props / arguments.
-			*
-			*	@return A list of properties.
-			*/
-			std::vector<Property>					fillProperties(std::vector<std::vector<std::string>>& splitProps)		noexcept;
-
-			/**
-			*	@brief Add a property to the given property group using the provided data.
-			*
-			*	@param propertyAsVector	Vector of properties. Element 0 is the property name, next elements are associated arguments.
-			*	@param out_properties	List of properties to update.
+			*	@return true & add the argument to the last property of out_properties on success, else return false.
 			*/
-			void									addProperty(std::vector<std::string>&	propertyAsVector,
-																std::vector<Property>&		out_properties)					noexcept;
+			bool									lookForNextPropertyArgument(std::string_view&		inout_parsingProps,
+																				bool&					out_isParsingArgument,
+																				std::vector<Property>&	out_properties)	noexcept;
 
 			/**
 			*	@brief Retrieve properties from a string if possible.
 			*
 			*	@param annotateMessage	The raw string contained in the __attribute__(annotate()) preprocessor.
 			*	@param annotationId		The annotation the annotate message should begin with to be considered as valid.
-			*	@param entityType		The type of the attached entity.
 			*
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getProperties(std::string&&			annotateMessage,
-																  std::string const&	annotationId)						noexcept;
+			opt::optional<std::vector<Property>>	getProperties(std::string_view	annotateMessage,
+																  std::string_view	annotationId)							noexcept;
 
 		public:
 			/**
@@ -119,7 +122,7 @@ namespace kodgen
 			void									setup(PropertyParsingSettings const& propertyParsingSettings)	noexcept;
 
 			/**
-			*	@brief	Clear all collected data such as parsingErrors or split props. Called to have a clean state and prepare to parse new properties.
+			*	@brief	Clear all collected data such as parsingErrors. Called to have a clean state and prepare to parse new properties.
 			*/
 			void									clean()															noexcept;
 
@@ -131,7 +134,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getNamespaceProperties(std::string annotateMessage)				noexcept;
+			opt::optional<std::vector<Property>>	getNamespaceProperties(std::string_view annotateMessage)			noexcept;
 			
 			/**
 			*	@brief Retrieve the properties from a class annotate attribute.
@@ -141,7 +144,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getClassProperties(std::string annotateMessage)					noexcept;
+			opt::optional<std::vector<Property>>	getClassProperties(std::string_view annotateMessage)				noexcept;
 			
 			/**
 			*	@brief Retrieve the properties from a struct annotate attribute.
@@ -151,7 +154,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getStructProperties(std::string annotateMessage)				noexcept;
+			opt::optional<std::vector<Property>>	getStructProperties(std::string_view annotateMessage)			noexcept;
 			
 			/**
 			*	@brief Retrieve the properties from a variable annotate attribute.
@@ -161,7 +164,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getVariableProperties(std::string annotateMessage)				noexcept;
+			opt::optional<std::vector<Property>>	getVariableProperties(std::string_view annotateMessage)			noexcept;
 
 			/**
 			*	@brief Retrieve the properties from a field annotate attribute.
@@ -171,7 +174,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getFieldProperties(std::string annotateMessage)					noexcept;
+			opt::optional<std::vector<Property>>	getFieldProperties(std::string_view annotateMessage)				noexcept;
 
 			/**
 			*	@brief Retrieve the properties from a function annotate attribute.
@@ -181,7 +184,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getFunctionProperties(std::string annotateMessage)				noexcept;
+			opt::optional<std::vector<Property>>	getFunctionProperties(std::string_view annotateMessage)			noexcept;
 
 			/**
 			*	@brief Retrieve the properties from a method annotate attribute.
@@ -191,7 +194,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getMethodProperties(std::string annotateMessage)				noexcept;
+			opt::optional<std::vector<Property>>	getMethodProperties(std::string_view annotateMessage)			noexcept;
 
 			/**
 			*	@brief Retrieve the properties from an enum annotate attribute.
@@ -201,7 +204,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getEnumProperties(std::string annotateMessage)					noexcept;
+			opt::optional<std::vector<Property>>	getEnumProperties(std::string_view annotateMessage)				noexcept;
 
 			/**
 			*	@brief Retrieve the properties from an enum value annotate attribute.
@@ -211,7 +214,7 @@ namespace kodgen
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getEnumValueProperties(std::string annotateMessage)				noexcept;
+			opt::optional<std::vector<Property>>	getEnumValueProperties(std::string_view annotateMessage)			noexcept;
 
 			/**
 			*	@brief Getter for _parsingErrorDescription field.
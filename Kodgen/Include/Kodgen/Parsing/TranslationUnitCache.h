@@ -0,0 +1,80 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include <clang-c/Index.h>
+
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	/**
+	*	Keeps libclang translation units alive between parsings of a same file.
+	*	The first parsing of a file builds a precompiled preamble, and all subsequent parsings reparse
+	*	the existing translation unit, only processing again what changed since the previous parsing.
+	*	Different files can be parsed concurrently, but a same file must not be parsed by multiple threads at the same time.
+	*/
+	class TranslationUnitCache
+	{
+		private:
+			struct CacheEntry
+			{
+				/** Index owning the translation unit. Each entry has its own index so that entries can be used from any thread. */
+				CXIndex				index			= nullptr;
+
+				/** Cached translation unit. nullptr if the last parsing failed. */
+				CXTranslationUnit	translationUnit	= nullptr;
+			};
+
+			/** Cached translation units, indexed by file path. */
+			std::unordered_map<fs::path, CacheEntry, PathHash>	_entries;
+
+			/** Mutex protecting _entries. */
+			std::mutex											_mutex;
+
+			/**
+			*	@brief Dispose the translation unit and the index of an entry.
+			*
+			*	@param entry The entry to dispose.
+			*/
+			static void	disposeEntry(CacheEntry& entry)	noexcept;
+
+		public:
+			TranslationUnitCache()								= default;
+			TranslationUnitCache(TranslationUnitCache const&)	= delete;
+			TranslationUnitCache(TranslationUnitCache&&)		= delete;
+			~TranslationUnitCache()								noexcept;
+
+			/**
+			*	@brief	Get an up-to-date translation unit for the provided file.
+			*			The translation unit is parsed the first time the file is requested, and reparsed on subsequent requests.
+			*			The returned translation unit is owned by the cache and must not be disposed.
+			*
+			*	@param file						Path to the file to parse.
+			*	@param compilationArguments		Arguments used to parse the file the first time it is requested.
+			*	@param parsingOptions			libclang parsing options (CXTranslationUnit_Flags) used to parse the file the first time it is requested.
+			*
+			*	@return The translation unit of the provided file, or nullptr if it could not be parsed.
+			*/
+			CXTranslationUnit	getTranslationUnit(fs::path const&					file,
+												   std::vector<char const*> const&	compilationArguments,
+												   unsigned int						parsingOptions)			noexcept;
+
+			/**
+			*	@brief Dispose all cached translation units.
+			*/
+			void				clear()																	noexcept;
+
+			TranslationUnitCache& operator=(TranslationUnitCache const&)	= delete;
+			TranslationUnitCache& operator=(TranslationUnitCache&&)			= delete;
+	};
+}
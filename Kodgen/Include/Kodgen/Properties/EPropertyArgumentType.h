@@ -0,0 +1,55 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	@brief Defines how a property argument has been interpreted by the PropertyParser.
+	*/
+	enum class EPropertyArgumentType : uint8
+	{
+		/**
+		*	The argument is a string literal like "Hello, world", or any text which doesn't match another type.
+		*	The value is stored in PropertyArgument::stringValue.
+		*/
+		String,
+
+		/**
+		*	The argument is an identifier, possibly qualified, like Value or kodgen::EEntityType::Class.
+		*	The value is stored in PropertyArgument::stringValue.
+		*/
+		Identifier,
+
+		/**
+		*	The argument is a decimal or hexadecimal integer like 42, -3 or 0xFF.
+		*	The value is stored in PropertyArgument::integerValue.
+		*/
+		Integer,
+
+		/**
+		*	The argument is a floating point number like 1.5, -2e3 or 0.5f.
+		*	The value is stored in PropertyArgument::floatingPointValue.
+		*/
+		FloatingPoint,
+
+		/**
+		*	The argument is either true or false.
+		*	The value is stored in PropertyArgument::booleanValue.
+		*/
+		Boolean,
+
+		/**
+		*	The argument is a list of arguments surrounded by argument enclosers, like (1, 2, 3).
+		*	The elements are stored in PropertyArgument::listValue.
+		*/
+		List
+	};
+}
\ No newline at end of file
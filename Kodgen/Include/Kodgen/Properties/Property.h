@@ -10,14 +10,22 @@
 #include <string>
 #include <vector>
 
+#include "Kodgen/Properties/PropertyArgument.h"
+
 namespace kodgen
 {
 	struct Property
 	{
 		/** Name of this property. */
-		std::string					name;
+		std::string						name;
 
 		/** Collection of all arguments of this property. */
-		std::vector<std::string>	arguments;
+		std::vector<std::string>		arguments;
+
+		/**
+		*	Arguments of this property converted to their actual type, in the same order as arguments.
+		*	Only filled when PropertyParsingSettings::shouldParseTypedArguments is true, else empty.
+		*/
+		std::vector<PropertyArgument>	typedArguments;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Kodgen/Properties/EPropertyArgumentType.h"
+
+namespace kodgen
+{
+	struct PropertyArgument
+	{
+		/** Type of this argument. Only the value field matching this type is relevant. */
+		EPropertyArgumentType			type				= EPropertyArgumentType::String;
+
+		/** Value of a String (quotes removed) or Identifier argument. */
+		std::string						stringValue;
+
+		/** Value of an Integer argument. */
+		int64							integerValue		= 0;
+
+		/** Value of a FloatingPoint argument. */
+		double							floatingPointValue	= 0.0;
+
+		/** Value of a Boolean argument. */
+		bool							booleanValue		= false;
+
+		/** Elements of a List argument. */
+		std::vector<PropertyArgument>	listValue;
+	};
+}
\ No newline at end of file
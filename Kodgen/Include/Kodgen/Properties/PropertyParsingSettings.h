@@ -25,6 +25,12 @@ namespace kodgen
 			/** Chars used to respectively start and close a group of sub properties. */
 			char			argumentEnclosers[2]	= { '(', ')' };
 
+			/**
+			*	Should property arguments also be converted to PropertyArgument during parsing (Property::typedArguments)?
+			*	Lets code generators use numbers, booleans and lists without converting the argument strings again for each generation.
+			*/
+			bool			shouldParseTypedArguments	= false;
+
 			/** Macro to use to attach properties to a namespace. */
 			std::string		namespaceMacroName		= "NAMESPACE";
 
@@ -37,7 +37,6 @@ namespace kodgen
 				 std::function<ReturnType(TaskBase*)>&&		task,
 				 std::vector<std::shared_ptr<TaskBase>>&&	deps = {})	noexcept;
 
-			virtual bool				isReadyToExecute()	const	noexcept override;
 			virtual void				execute()					noexcept override;
 			virtual bool				hasFinished()		const	noexcept override;
 	};
@@ -13,21 +13,6 @@ Task<ReturnType>::Task(char const* name, std::function<ReturnType(TaskBase*)>&&
 {
 }
 
-template <typename ReturnType>
-bool Task<ReturnType>::isReadyToExecute() const noexcept
-{
-	for (std::shared_ptr<TaskBase> const& dependency : dependencies)
-	{
-		//If any of the dependencies have not finished executing, this task is not ready
-		if (!dependency->hasFinished())
-		{
-			return false;
-		}
-	}
-
-	return true;
-}
-
 template <typename ReturnType>
 void Task<ReturnType>::execute() noexcept
 {
@@ -10,16 +10,70 @@
 #include <vector>
 #include <string>
 #include <memory>	//std::shared_ptr
+#include <atomic>	//std::atomic_size_t
+#include <mutex>
+#include <condition_variable>
 
 namespace kodgen
 {
 	class TaskBase
 	{
 		friend class TaskHelper;
+		friend class ThreadPool;
 
 		private:
 			/** Name of the task. */
-			std::string	_name;
+			std::string								_name;
+
+			/** Number of dependencies which have not finished their execution yet. */
+			std::atomic_size_t						_pendingDependenciesCount;
+
+			/** Tasks depending on this task, notified when this task completes. */
+			std::vector<std::shared_ptr<TaskBase>>	_continuations;
+
+			/** Mutex protecting _continuations and _isCompleted. */
+			mutable std::mutex						_continuationsMutex;
+
+			/** Condition used to notify threads waiting for this task to complete. */
+			mutable std::condition_variable			_completedCondition;
+
+			/** Set to true once this task has completed and released its continuations. */
+			bool									_isCompleted = false;
+
+			/**
+			*	@brief Register a task to notify when this task completes.
+			*	
+			*	@param continuation The task depending on this task.
+			*
+			*	@return true if the continuation has been registered, false if this task has already completed.
+			*/
+			bool									addContinuation(std::shared_ptr<TaskBase> const& continuation)	noexcept;
+
+			/**
+			*	@brief Mark this task as completed and wake up the threads waiting for it.
+			*
+			*	@return The continuations of this task. They are released by this task so that they don't keep each other alive.
+			*/
+			std::vector<std::shared_ptr<TaskBase>>	complete()														noexcept;
+
+			/**
+			*	@brief Notify this task that one of its dependencies has completed.
+			*
+			*	@return true if this task just became ready to execute, else false.
+			*/
+			bool									notifyDependencyCompleted()										noexcept;
+
+			/**
+			*	@brief Check whether this task has been marked as completed by its ThreadPool.
+			*
+			*	@return true if this task has completed, else false.
+			*/
+			bool									isCompleted()											const	noexcept;
+
+			/**
+			*	@brief Block the calling thread until this task is marked as completed by its ThreadPool.
+			*/
+			void									waitCompletion()										const	noexcept;
 
 		protected:
 			/** Dependent tasks which must terminate before this task is executed. */
@@ -29,8 +83,8 @@ namespace kodgen
 			TaskBase()														= delete;
 			TaskBase(char const*								name,
 					 std::vector<std::shared_ptr<TaskBase>>&&	deps = {})	noexcept;
-			TaskBase(TaskBase const&)										= default;
-			TaskBase(TaskBase&&)											= default;
+			TaskBase(TaskBase const&)										= delete;
+			TaskBase(TaskBase&&)											= delete;
 			virtual ~TaskBase()												= default;
 
 			/**
@@ -39,7 +93,7 @@ namespace kodgen
 			*	
 			*	@return true if this task is ready to execute, else false.
 			*/
-			virtual bool		isReadyToExecute()	const	noexcept = 0;
+			bool				isReadyToExecute()	const	noexcept;
 
 			/**
 			*	@brief Execute the underlying task.
@@ -60,7 +114,7 @@ namespace kodgen
 			*/
 			std::string const&	getName()			const	noexcept;
 
-			TaskBase& operator=(TaskBase const&)	= default;
-			TaskBase& operator=(TaskBase&&)			= default;
+			TaskBase& operator=(TaskBase const&)	= delete;
+			TaskBase& operator=(TaskBase&&)			= delete;
 	};
-}
\ No newline at end of file
+}
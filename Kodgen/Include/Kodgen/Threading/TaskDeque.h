@@ -0,0 +1,62 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <memory>	//std::shared_ptr
+
+#include "Kodgen/Threading/TaskBase.h"
+
+namespace kodgen
+{
+	/**
+	*	Queue of ready-to-execute tasks owned by a single ThreadPool worker.
+	*	The owner pushes and pops tasks at the back (LIFO, cache friendly) while other workers
+	*	steal tasks from the front (FIFO, oldest tasks first) to balance the load.
+	*/
+	class TaskDeque
+	{
+		private:
+			/** Tasks queued in this deque. */
+			std::deque<std::shared_ptr<TaskBase>>	_tasks;
+
+			/** Mutex protecting _tasks. It is only contended when a worker steals from this deque. */
+			mutable std::mutex						_mutex;
+
+		public:
+			TaskDeque()					= default;
+			TaskDeque(TaskDeque const&)	= delete;
+			TaskDeque(TaskDeque&&)		= delete;
+			~TaskDeque()				= default;
+
+			/**
+			*	@brief Push a task at the back of the deque.
+			*	
+			*	@param task The task to push.
+			*/
+			void						push(std::shared_ptr<TaskBase>&& task)	noexcept;
+
+			/**
+			*	@brief Pop the most recently pushed task. Should be called by the deque owner.
+			*	
+			*	@return A valid shared_ptr pointing to a ready-to-execute task if the deque is not empty, else an empty shared_ptr.
+			*/
+			std::shared_ptr<TaskBase>	pop()									noexcept;
+
+			/**
+			*	@brief Steal the oldest task. Should be called by workers not owning the deque.
+			*	
+			*	@return A valid shared_ptr pointing to a ready-to-execute task if the deque is not empty, else an empty shared_ptr.
+			*/
+			std::shared_ptr<TaskBase>	steal()									noexcept;
+
+			TaskDeque& operator=(TaskDeque const&)	= delete;
+			TaskDeque& operator=(TaskDeque&&)		= delete;
+	};
+}
@@ -8,17 +8,17 @@
 #pragma once
 
 #include <string>
-#include <list>
 #include <vector>
 #include <thread>
 #include <condition_variable>
 #include <mutex>
-#include <atomic>		//std::atomic_uint
+#include <atomic>		//std::atomic_uint, std::atomic_bool, std::atomic_size_t
 #include <functional>	//std::bind
 #include <memory>		//std::shared_ptr
 #include <type_traits>	//std::invoke_result
 
 #include "Kodgen/Threading/Task.h"
+#include "Kodgen/Threading/TaskDeque.h"
 #include "Kodgen/Threading/ETerminationMode.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
 
@@ -27,22 +27,37 @@ namespace kodgen
 	class ThreadPool
 	{
 		private:
+			/** Pool the current thread is a worker of, nullptr if the current thread is not a ThreadPool worker. */
+			static thread_local ThreadPool*			_currentThreadPool;
+
+			/** Index of the current worker in its pool. Only relevant if _currentThreadPool is not nullptr. */
+			static thread_local uint32				_currentWorkerIndex;
+
 			/** Are workers allowed to process queued tasks? */
-			bool									_isRunning	= true;
+			std::atomic_bool						_isRunning	= true;
 
 			/** Collection of all workers in this pool. */
 			std::vector<std::thread>				_workers;
 
-			/** List of all tasks. */
-			std::list<std::shared_ptr<TaskBase>>	_tasks;
+			/** Task deques, one per worker. Workers pop from their own deque and steal from the others when it is empty. */
+			std::vector<TaskDeque>					_taskDeques;
+
+			/** Number of ready tasks pushed to the deques but not yet grabbed by a worker. */
+			std::atomic_size_t						_queuedTasksCount;
+
+			/** Index of the next deque to push a task submitted from outside the pool. */
+			std::atomic_uint						_nextDequeIndex;
 
 			/** Set to true when the ThreadPool destructor has been called. */
-			bool									_destructorCalled	= false;
+			std::atomic_bool						_destructorCalled	= false;
 
-			/** Condition used to notify workers there are tasks to proceed. */
+			/** Condition used to notify sleeping workers there are tasks to proceed. */
 			std::condition_variable					_taskCondition;
 
-			/** Mutex used with taskCondition. */
+			/** Condition used to notify joinWorkers callers that all workers went to sleep. */
+			std::condition_variable					_idleCondition;
+
+			/** Mutex used with taskCondition and idleCondition. It is only locked to put workers to sleep, wake them up or join them. */
 			std::mutex								_taskMutex;
 
 			/** Number of workers currently running a task. */
@@ -50,23 +65,58 @@ namespace kodgen
 
 			/**
 			*	@brief Routine run by workers.
+			*
+			*	@param workerIndex Index of the worker running the routine, used to identify the deque it owns.
 			*/
-			void						workerRoutine()				noexcept;
+			void						workerRoutine(uint32 workerIndex)				noexcept;
 
 			/**
 			*	@brief	Retrieve a task which is ready to execute.
-			*			This method doesn't lock the task mutex so make sure _tasks is safe to access BEFORE the method is called.
+			*			The worker deque is checked first, then tasks are stolen from the other workers deques.
+			*
+			*	@param workerIndex Index of the worker retrieving a task.
 			*	
 			*	@return A valid shared_ptr pointing to a ready-to-execute task if any, else an empty shared_ptr.
 			*/
-			std::shared_ptr<TaskBase>	getTask()					noexcept;
+			std::shared_ptr<TaskBase>	getTask(uint32 workerIndex)						noexcept;
+
+			/**
+			*	@brief	Push a ready task to a deque and wake a sleeping worker up.
+			*			If called from a worker of this pool, the task is pushed to the worker deque, else deques are filled in a round-robin fashion.
+			*
+			*	@param task The task to push.
+			*/
+			void						pushTask(std::shared_ptr<TaskBase>&& task)		noexcept;
+
+			/**
+			*	@brief	Register a newly submitted task as a continuation of its dependencies.
+			*			The task is pushed to a deque right away if all its dependencies have already completed.
+			*
+			*	@param task The submitted task.
+			*/
+			void						scheduleTask(std::shared_ptr<TaskBase>&& task)	noexcept;
+
+			/**
+			*	@brief Mark a task as completed and push its continuations which just became ready to execute.
+			*
+			*	@param task The task which just finished its execution.
+			*/
+			void						completeTask(TaskBase& task)					noexcept;
+
+			/**
+			*	@brief	Release the continuations of a task which will never be executed, as well as the continuations of its continuations.
+			*			Breaks the shared ownership cycles between tasks and their dependencies.
+			*
+			*	@param task The task to release the continuations of.
+			*/
+			static void					releaseContinuations(TaskBase& task)			noexcept;
 
 			/**
 			*	@brief Check whether a worker should keep running or terminate.
 			*	
 			*	@return true if the worker should continue to poll new tasks, else false.
 			*/
-			bool						shouldKeepRunning()	const	noexcept;
+			bool						shouldKeepRunning()						const	noexcept;
 
 		public:
 			/** Termination mode to apply when this Thread pool will be destroyed. */
@@ -93,10 +143,36 @@ namespace kodgen
 												   std::vector<std::shared_ptr<TaskBase>>&& deps = {})	noexcept;
 
 			/**
-			*	@brief Join all workers.
+			*	@brief	Join all workers.
+			*			The calling thread sleeps until all workers are idle, i.e. all submitted tasks have been executed
+			*			or the pool is not running.
 			*/
 			void						joinWorkers()													noexcept;
 
+			/**
+			*	@brief	Wait for a submitted task to complete.
+			*			If called from a worker of this pool, the worker keeps executing other tasks while waiting,
+			*			otherwise the calling thread sleeps until the task completes.
+			*			Tasks discarded by the pool destruction (ETerminationMode::FinishCurrent) are considered completed.
+			*
+			*	@param task The task to wait for. It must have been returned by submitTask on this pool.
+			*/
+			void						waitFor(std::shared_ptr<TaskBase> const& task)					noexcept;
+
+			/**
+			*	@brief Get the index of the worker running the calling thread. Must be called from a worker of this pool, typically inside a task.
+			*
+			*	@return The index of the current worker, in the range [0, getWorkerCount()[.
+			*/
+			uint32						getCurrentWorkerIndex()									const	noexcept;
+
+			/**
+			*	@brief Get the number of workers in this pool.
+			*
+			*	@return The number of workers.
+			*/
+			uint32						getWorkerCount()										const	noexcept;
+
 			/**
 			*	@brief Allow or disallow workers to process tasks.
 			* 
@@ -11,16 +11,10 @@ std::shared_ptr<TaskBase> ThreadPool::submitTask(std::string const& taskName, Ca
 	//Return type of the submitted task
 	using ReturnType = typename std::invoke_result_t<Callable, TaskBase*>;
 
-	std::vector<std::shared_ptr<TaskBase>> depsCopy = deps;
-
 	std::shared_ptr<Task<ReturnType>> newTask =
 		std::make_shared<Task<ReturnType>>(taskName.data(), std::forward<Callable>(callable), std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps));
 
-	_taskMutex.lock();
-	_tasks.emplace_back(newTask);
-	_taskMutex.unlock();
-
-	_taskCondition.notify_one();
+	scheduleTask(newTask);
 
 	return newTask;
 }
\ No newline at end of file
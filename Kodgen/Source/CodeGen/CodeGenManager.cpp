@@ -1,7 +1,16 @@
 #include "Kodgen/CodeGen/CodeGenManager.h"
 
+#include <algorithm>	//std::sort
+
+#include <clang-c/Index.h>
+
+#include "Kodgen/Config.h"
 #include "Kodgen/CodeGen/GeneratedFile.h"
+#include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/CompilerHelpers.h"
 #include "Kodgen/Parsing/ParsingSettings.h"	//ParsingSettings::parsingMacro
+#include "Kodgen/Parsing/ParsingResultWriter.h"
+#include "Kodgen/Parsing/ParsingResultReader.h"
 
 using namespace kodgen;
 
@@ -10,8 +19,16 @@ CodeGenManager::CodeGenManager(uint32 threadCount) noexcept:
 {
 }
 
+ProjectStructClassTree const& CodeGenManager::getProjectStructClassTree() const noexcept
+{
+	return _projectStructClassTree;
+}
+
 std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& codeGenUnit, CodeGenResult& out_genResult, bool forceRegenerateAll) noexcept
 {
+	//Worker processes don't have the thread pool threads
+	assert(!_isWorkerProcess);
+
 	std::set<fs::path> result;
 
 	//Iterate over all "toParseFiles"
@@ -19,7 +36,7 @@ std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& cod
 	{
 		if (fs::exists(path) && !fs::is_directory(path))
 		{
-			if (!codeGenUnit.isUpToDate(path) || forceRegenerateAll)
+			if (!isUpToDate(codeGenUnit, path) || forceRegenerateAll)
 			{
 				result.emplace(path);
 			}
@@ -35,39 +52,16 @@ std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& cod
 		}
 	}
 
-	//Iterate over all "toParseDirectories"
+	//Build the ignored path filter once, so that the scan tasks only read it
+	DirectoryScanContext scanContext{codeGenUnit, forceRegenerateAll, settings.getIgnoredPathFilter(), {}, {}, result, out_genResult.upToDateFiles};
+
+	//Iterate over all "toParseDirectories" in parallel, each directory is scanned by its own task
 	for (fs::path pathToIncludedDir : settings.getToProcessDirectories())
 	{
 		if (fs::exists(pathToIncludedDir) && fs::is_directory(pathToIncludedDir))
 		{
-			for (fs::recursive_directory_iterator directoryIt = fs::recursive_directory_iterator(pathToIncludedDir, fs::directory_options::follow_directory_symlink); directoryIt != fs::recursive_directory_iterator(); directoryIt++)
-			{
-				fs::directory_entry entry = *directoryIt;
-
-				//Just to make sure the entry hasn't been deleted since beginning of directory iteration
-				if (entry.exists())
-				{
-					if (entry.is_regular_file())
-					{
-						if (settings.isSupportedFileExtension(entry.path().extension()) && !settings.isIgnoredFile(entry.path()))
-						{
-							if (!codeGenUnit.isUpToDate(entry.path()) || forceRegenerateAll)
-							{
-								result.emplace(entry.path());
-							}
-							else
-							{
-								out_genResult.upToDateFiles.push_back(entry.path());
-							}
-						}
-					}
-					else if (entry.is_directory() && settings.isIgnoredDirectory(entry.path()))
-					{
-						//Don't iterate on ignored directory content
-						directoryIt.disable_recursion_pending();
-					}
-				}
-			}
+			//Paths of scanned entries are built from the canonical directory, so they can be filtered without being canonicalized
+			submitDirectoryScanTask(FilesystemHelpers::sanitizePath(pathToIncludedDir), scanContext);
 		}
 		else if (logger != nullptr)
 		{
@@ -76,9 +70,319 @@ std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& cod
 		}
 	}
 
+	//Wait for all scan tasks, including the ones submitted for subdirectories
+	_threadPool.joinWorkers();
+
 	return result;
 }
 
+void CodeGenManager::submitDirectoryScanTask(fs::path directory, DirectoryScanContext& context) noexcept
+{
+	{
+		std::lock_guard lock(context.mutex);
+
+		if (!context.scannedDirectories.insert(directory).second)
+		{
+			return;
+		}
+	}
+
+	_threadPool.submitTask("Scan directory", [this, directory = std::move(directory), &context](TaskBase*)
+						   {
+							   scanDirectory(directory, context);
+						   });
+}
+
+void CodeGenManager::scanDirectory(fs::path const& directory, DirectoryScanContext& context) noexcept
+{
+	std::vector<fs::path>	toProcessFiles;
+	std::vector<fs::path>	upToDateFiles;
+	std::error_code			error;
+	std::error_code			entryError;
+
+	for (fs::directory_iterator directoryIt = fs::directory_iterator(directory, fs::directory_options::follow_directory_symlink, error); !error && directoryIt != fs::directory_iterator(); directoryIt.increment(error))
+	{
+		fs::directory_entry const& entry = *directoryIt;
+
+		//Entry types are cached during the directory iteration, so these checks don't issue extra stat calls for regular entries.
+		//They also make sure the entry hasn't been deleted since the beginning of the directory iteration.
+		if (entry.is_regular_file(entryError))
+		{
+			if (settings.isSupportedFileExtension(entry.path().extension()) && !context.ignoredPathFilter.isIgnoredFile(entry.path()))
+			{
+				if (context.forceRegenerateAll || !isUpToDate(context.codeGenUnit, entry.path()))
+				{
+					toProcessFiles.emplace_back(entry.path());
+				}
+				else
+				{
+					upToDateFiles.emplace_back(entry.path());
+				}
+			}
+		}
+		else if (entry.is_directory(entryError))
+		{
+			//Only symlinked directories need to be resolved to be filtered and to be recognized if already scanned
+			fs::path subdirectory = entry.is_symlink(entryError) ? FilesystemHelpers::sanitizePath(entry.path()) : entry.path();
+
+			if (!subdirectory.empty() && !context.ignoredPathFilter.isIgnoredDirectory(subdirectory))
+			{
+				submitDirectoryScanTask(std::move(subdirectory), context);
+			}
+		}
+	}
+
+	//Publish all the files of the directory at once
+	if (!toProcessFiles.empty() || !upToDateFiles.empty())
+	{
+		std::lock_guard lock(context.mutex);
+
+		context.toProcessFiles.insert(std::make_move_iterator(toProcessFiles.begin()), std::make_move_iterator(toProcessFiles.end()));
+		context.upToDateFiles.insert(context.upToDateFiles.end(), std::make_move_iterator(upToDateFiles.begin()), std::make_move_iterator(upToDateFiles.end()));
+	}
+}
+
+bool CodeGenManager::isUpToDate(CodeGenUnit const& codeGenUnit, fs::path const& file) noexcept
+{
+	if (settings.shouldUseGenerationManifest)
+	{
+		//Check generated files first so that missing generated headers are always created
+		return codeGenUnit.hasGeneratedFiles(file) && _generationManifest.isUpToDate(file);
+	}
+
+	return codeGenUnit.isUpToDate(file);
+}
+
+uint64 CodeGenManager::computeParsingSettingsHash(ParsingSettings const& parsingSettings) const noexcept
+{
+	PropertyParsingSettings const& propertySettings = parsingSettings.propertyParsingSettings;
+
+	//Sort include directories since they are stored in an unordered container
+	std::vector<std::string> includeDirectories;
+
+	for (fs::path const& includeDirectory : parsingSettings.getProjectIncludeDirectories())
+	{
+		includeDirectories.emplace_back(includeDirectory.string());
+	}
+
+	std::sort(includeDirectories.begin(), includeDirectories.end());
+
+	std::string settingsString =	std::to_string(KODGEN_VERSION_MAJOR) + "." + std::to_string(KODGEN_VERSION_MINOR) + "." + std::to_string(KODGEN_VERSION_PATCH) + "\n" +
+									std::to_string(static_cast<uint8>(parsingSettings.cppVersion)) + "\n" +
+									parsingSettings.getCompilerExeName() + "\n" +
+									parsingSettings.getPrefixHeader().string() + "\n" +
+									propertySettings.propertySeparator + propertySettings.argumentSeparator + propertySettings.argumentEnclosers[0] + propertySettings.argumentEnclosers[1] + "\n" +
+									Helpers::toString(propertySettings.shouldParseTypedArguments) + "\n" +
+									propertySettings.namespaceMacroName + "\n" + propertySettings.classMacroName + "\n" + propertySettings.structMacroName + "\n" +
+									propertySettings.variableMacroName + "\n" + propertySettings.fieldMacroName + "\n" + propertySettings.functionMacroName + "\n" +
+									propertySettings.methodMacroName + "\n" + propertySettings.enumMacroName + "\n" + propertySettings.enumValueMacroName + "\n" +
+									Helpers::toString(parsingSettings.shouldParseAllNamespaces) + Helpers::toString(parsingSettings.shouldParseAllClasses) +
+									Helpers::toString(parsingSettings.shouldParseAllStructs) + Helpers::toString(parsingSettings.shouldParseAllVariables) +
+									Helpers::toString(parsingSettings.shouldParseAllFields) + Helpers::toString(parsingSettings.shouldParseAllFunctions) +
+									Helpers::toString(parsingSettings.shouldParseAllMethods) + Helpers::toString(parsingSettings.shouldParseAllEnums) +
+									Helpers::toString(parsingSettings.shouldParseAllEnumValues) + "\n";
+
+	for (std::string const& includeDirectory : includeDirectories)
+	{
+		settingsString += includeDirectory + "\n";
+	}
+
+	//Parsing results depend on the libclang version and on the compiler providing the native include directories
+	CXString clangVersion = clang_getClangVersion();
+
+	settingsString += std::string(clang_getCString(clangVersion)) + "\n" + CompilerHelpers::getCompilerStamp(parsingSettings.getCompilerExeName()) + "\n";
+
+	clang_disposeString(clangVersion);
+
+	//Effective compilation arguments: native include directories, PCH, and the flags of each compilation database target
+	auto appendCompilationArguments = [&settingsString](std::vector<char const*> const& compilationArguments)
+	{
+		for (char const* compilationArgument : compilationArguments)
+		{
+			settingsString += compilationArgument;
+			settingsString += '\0';
+		}
+
+		settingsString += "\n";
+	};
+
+	appendCompilationArguments(parsingSettings.getCompilationArguments());
+
+	for (std::vector<char const*> const& targetCompilationArguments : parsingSettings.getTargetCompilationArguments())
+	{
+		appendCompilationArguments(targetCompilationArguments);
+	}
+
+	//The compilation database content decides which target each file belongs to
+	uint64 fileHash;
+
+	if (!parsingSettings.getCompilationDatabasePath().empty() && GenerationManifest::computeFileHash(parsingSettings.getCompilationDatabasePath(), fileHash))
+	{
+		settingsString += std::to_string(fileHash) + "\n";
+	}
+
+	//The prefix header is precompiled, so the files it includes are not reported as included files of the parsed files
+	if (!parsingSettings.getPrefixHeader().empty() && GenerationManifest::computeFileHash(parsingSettings.getPrefixHeader(), fileHash))
+	{
+		settingsString += std::to_string(fileHash) + "\n";
+	}
+
+	//Each PCH lists the files it was built from, so any change to them changes the hash
+	settingsString += parsingSettings.getPrecompiledHeaderInputsStamp();
+
+	return GenerationManifest::computeHash(settingsString);
+}
+
+uint64 CodeGenManager::computeSettingsHash(ParsingSettings const& parsingSettings, CodeGenUnit const& codeGenUnit) const noexcept
+{
+	std::string settingsString =	settings.generatorVersion + "\n" +
+									codeGenUnit.getSettings()->getOutputDirectory().string() + "\n" +
+									Helpers::toString(codeGenUnit.getSettings()->shouldTraverseEntitiesOnce) + "\n";
+
+	return GenerationManifest::computeHash(settingsString, computeParsingSettingsHash(parsingSettings));
+}
+
+void CodeGenManager::setupParsingResultCache(ParsingSettings const& parsingSettings, CodeGenUnit const& codeGenUnit) noexcept
+{
+	fs::path cacheDirectory = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::parsingResultCacheDirectoryName;
+
+	if (!_parsingResultCache.setup(cacheDirectory, computeParsingSettingsHash(parsingSettings)) && logger != nullptr)
+	{
+		logger->log("Parsing result cache directory " + cacheDirectory.string() + " could not be created. All files will be parsed.", ILogger::ELogSeverity::Warning);
+	}
+}
+
+std::vector<std::vector<fs::path>> CodeGenManager::shardFiles(std::set<fs::path> const& files, uint32 shardCount) const noexcept
+{
+	assert(shardCount > 0u);
+
+	std::vector<std::vector<fs::path>> shards(shardCount);
+
+	for (fs::path const& file : files)
+	{
+		shards[GenerationManifest::computeHash(file.string()) % shardCount].push_back(file);
+	}
+
+	return shards;
+}
+
+bool CodeGenManager::shouldUseWorkerProcesses(CodeGenUnit const& codeGenUnit) const noexcept
+{
+	if (settings.workerProcessCount <= 1u)
+	{
+		return false;
+	}
+
+	if (!ShardWorkerProcess::isSupported())
+	{
+		if (logger != nullptr)
+		{
+			logger->log("Worker processes are not supported on this platform. All files are processed by the current process.", ILogger::ELogSeverity::Warning);
+		}
+
+		return false;
+	}
+
+	//Each worker runs its iterations on its own, so an iteration can't wait for the previous iteration of the files of other workers
+	if (codeGenUnit.getIterationCount() > 1u && !settings.shouldPipelineIterations)
+	{
+		if (logger != nullptr)
+		{
+			logger->log("Worker processes require shouldPipelineIterations when the code generation unit runs multiple iterations. All files are processed by the current process.", ILogger::ELogSeverity::Warning);
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+bool CodeGenManager::sendShardFileResult(int channel, fs::path const& file, FileParsingResult const& parsingResult, bool completed) const noexcept
+{
+	FileParsingResult	fileResult;
+	bool				isParsed	= parsingResult.errors.empty();
+
+	fileResult.parsedFile		= file;
+	fileResult.includedFiles	= parsingResult.includedFiles;
+
+	if (isParsed)
+	{
+		fileResult.structClassTree = parsingResult.structClassTree;
+	}
+
+	ParsingResultWriter writer;
+
+	writer.write(fileResult);
+
+	//Message: completed flag, parsed flag, then the file result
+	std::string message;
+
+	message.reserve(2u + writer.getData().size());
+	message.push_back(completed ? 1 : 0);
+	message.push_back(isParsed ? 1 : 0);
+	message.append(writer.getData());
+
+	return ShardWorkerProcess::sendMessage(channel, message);
+}
+
+void CodeGenManager::applyShardFileResult(std::string_view message, CodeGenResult& out_genResult) noexcept
+{
+	FileParsingResult fileResult;
+
+	if (message.size() < 2u || !ParsingResultReader(message.substr(2u)).read(fileResult))
+	{
+		if (logger != nullptr)
+		{
+			logger->log("Received an invalid file result from a worker process.", ILogger::ELogSeverity::Error);
+		}
+
+		out_genResult.completed = false;
+
+		return;
+	}
+
+	bool completed	= (message[0] != 0);
+	bool isParsed	= (message[1] != 0);
+
+	if (isParsed)
+	{
+		_projectStructClassTree.updateFile(fileResult.parsedFile, fileResult.structClassTree);
+	}
+
+	if (settings.shouldUseGenerationManifest)
+	{
+		if (completed)
+		{
+			_generationManifest.updateSourceFile(fileResult.parsedFile, fileResult.includedFiles);
+		}
+		else
+		{
+			//Make sure the file is processed again on next generation
+			_generationManifest.removeSourceFile(fileResult.parsedFile);
+		}
+	}
+}
+
+void CodeGenManager::loadGenerationManifest(ParsingSettings const& parsingSettings, CodeGenUnit const& codeGenUnit) noexcept
+{
+	fs::path manifestPath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::generationManifestFilename;
+
+	if (!_generationManifest.load(manifestPath, computeSettingsHash(parsingSettings, codeGenUnit)) && logger != nullptr && fs::exists(manifestPath))
+	{
+		logger->log("Generation manifest " + manifestPath.string() + " could not be loaded. All files will be regenerated.", ILogger::ELogSeverity::Warning);
+	}
+}
+
+void CodeGenManager::saveGenerationManifest(CodeGenUnit const& codeGenUnit) const noexcept
+{
+	fs::path manifestPath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::generationManifestFilename;
+
+	if (!_generationManifest.save(manifestPath) && logger != nullptr)
+	{
+		logger->log("Failed to save the generation manifest " + manifestPath.string() + ".", ILogger::ELogSeverity::Warning);
+	}
+}
+
 uint32 CodeGenManager::getThreadCount(uint32 initialThreadCount) const noexcept
 {
 	if (initialThreadCount == 0)
@@ -98,7 +402,7 @@ uint32 CodeGenManager::getThreadCount(uint32 initialThreadCount) const noexcept
 
 void CodeGenManager::generateMacrosFile(ParsingSettings const& parsingSettings, fs::path const& outputDirectory) const noexcept
 {
-	GeneratedFile macrosDefinitionFile(outputDirectory / CodeGenUnitSettings::entityMacrosFilename);
+	GeneratedFile macrosDefinitionFile(outputDirectory / CodeGenUnitSettings::entityMacrosFilename, fs::path(), settings.shouldUseGenerationManifest, logger);
 
 	macrosDefinitionFile.writeLines("#pragma once",
 									"");
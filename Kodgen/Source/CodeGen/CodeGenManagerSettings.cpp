@@ -2,6 +2,7 @@
 
 #include "Kodgen/Misc/TomlUtility.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/Helpers.h"
 
 using namespace kodgen;
 
@@ -40,6 +41,10 @@ bool CodeGenManagerSettings::loadSettingsValues(toml::value const& tomlData, ILo
 		loadToProcessDirectories(tomlGeneratorSettings, logger);
 		loadIgnoredFiles(tomlGeneratorSettings, logger);
 		loadIgnoredDirectories(tomlGeneratorSettings, logger);
+		loadShouldPipelineIterations(tomlGeneratorSettings, logger);
+		loadShouldUseGenerationManifest(tomlGeneratorSettings, logger);
+		loadShouldCacheParsingResults(tomlGeneratorSettings, logger);
+		loadWorkerProcessCount(tomlGeneratorSettings, logger);
 
 		return true;
 	}
@@ -74,6 +79,7 @@ bool CodeGenManagerSettings::addIgnoredFile(fs::path const& path) noexcept
 	bool added = _ignoredFiles.emplace(path).second;
 
 	_ignoredFilesDirtyFlag |= added;
+	_ignoredPathFilterDirtyFlag |= added;
 
 	return added;
 }
@@ -83,6 +89,7 @@ bool CodeGenManagerSettings::addIgnoredDirectory(fs::path const& path) noexcept
 	bool added = _ignoredDirectories.emplace(path).second;
 
 	_ignoredDirectoriesDirtyFlag |= added;
+	_ignoredPathFilterDirtyFlag |= added;
 
 	return added;
 }
@@ -113,7 +120,12 @@ void CodeGenManagerSettings::removeToProcessDirectory(fs::path const& path) noex
 
 void CodeGenManagerSettings::removeIgnoredFile(fs::path const& path) noexcept
 {
-	_ignoredFiles.erase(FilesystemHelpers::sanitizePath(path));
+	//Patterns and paths which don't exist are stored as provided
+	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(path);
+
+	_ignoredFiles.erase(sanitizedPath.empty() ? path : sanitizedPath);
+
+	_ignoredPathFilterDirtyFlag = true;
 }
 
 void CodeGenManagerSettings::removeSupportedFileExtension(fs::path const& ext) noexcept
@@ -123,7 +135,12 @@ void CodeGenManagerSettings::removeSupportedFileExtension(fs::path const& ext) n
 
 void CodeGenManagerSettings::removeIgnoredDirectory(fs::path const& path) noexcept
 {
-	_ignoredDirectories.erase(FilesystemHelpers::sanitizePath(path));
+	//Patterns and paths which don't exist are stored as provided
+	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(path);
+
+	_ignoredDirectories.erase(sanitizedPath.empty() ? path : sanitizedPath);
+
+	_ignoredPathFilterDirtyFlag = true;
 }
 
 void CodeGenManagerSettings::clearToProcessFiles() noexcept
@@ -139,11 +156,15 @@ void CodeGenManagerSettings::clearToProcessDirectories() noexcept
 void CodeGenManagerSettings::clearIgnoredFiles() noexcept
 {
 	_ignoredFiles.clear();
+
+	_ignoredPathFilterDirtyFlag = true;
 }
 
 void CodeGenManagerSettings::clearIgnoredDirectories() noexcept
 {
 	_ignoredDirectories.clear();
+
+	_ignoredPathFilterDirtyFlag = true;
 }
 
 void CodeGenManagerSettings::clearSupportedFileExtensions() noexcept
@@ -157,6 +178,20 @@ bool CodeGenManagerSettings::isSupportedFileExtension(fs::path const& extension)
 }
 
 bool CodeGenManagerSettings::isIgnoredFile(fs::path const& file) noexcept
+{
+	std::error_code error;
+
+	return getIgnoredPathFilter().isIgnoredFile(fs::absolute(file, error).lexically_normal());
+}
+
+bool CodeGenManagerSettings::isIgnoredDirectory(fs::path const& directory) noexcept
+{
+	std::error_code error;
+
+	return getIgnoredPathFilter().isIgnoredDirectory(fs::absolute(directory, error).lexically_normal());
+}
+
+PathFilter const& CodeGenManagerSettings::getIgnoredPathFilter() noexcept
 {
 	if (_ignoredFilesDirtyFlag)
 	{
@@ -164,18 +199,30 @@ bool CodeGenManagerSettings::isIgnoredFile(fs::path const& file) noexcept
 		_ignoredFilesDirtyFlag = false;
 	}
 
-	return _ignoredFiles.find(fs::exists(file) ? FilesystemHelpers::sanitizePath(file) : file) != _ignoredFiles.end();
-}
-
-bool CodeGenManagerSettings::isIgnoredDirectory(fs::path const& directory) noexcept
-{
 	if (_ignoredDirectoriesDirtyFlag)
 	{
 		sanitizePaths(_ignoredDirectories);
 		_ignoredDirectoriesDirtyFlag = false;
 	}
 
-	return _ignoredDirectories.find(fs::exists(directory) ? FilesystemHelpers::sanitizePath(directory) : directory) != _ignoredDirectories.end();
+	if (_ignoredPathFilterDirtyFlag)
+	{
+		_ignoredPathFilter.clear();
+
+		for (fs::path const& ignoredFile : _ignoredFiles)
+		{
+			_ignoredPathFilter.addIgnoredFile(ignoredFile);
+		}
+
+		for (fs::path const& ignoredDirectory : _ignoredDirectories)
+		{
+			_ignoredPathFilter.addIgnoredDirectory(ignoredDirectory);
+		}
+
+		_ignoredPathFilterDirtyFlag = false;
+	}
+
+	return _ignoredPathFilter;
 }
 
 void CodeGenManagerSettings::loadSupportedFileExtensions(toml::value const& generationSettings, ILogger* logger) noexcept
@@ -322,6 +369,38 @@ void CodeGenManagerSettings::loadIgnoredDirectories(toml::value const& generatio
 	}
 }
 
+void CodeGenManagerSettings::loadShouldPipelineIterations(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "shouldPipelineIterations", shouldPipelineIterations, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load shouldPipelineIterations: " + Helpers::toString(shouldPipelineIterations));
+	}
+}
+
+void CodeGenManagerSettings::loadShouldUseGenerationManifest(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "shouldUseGenerationManifest", shouldUseGenerationManifest, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load shouldUseGenerationManifest: " + Helpers::toString(shouldUseGenerationManifest));
+	}
+}
+
+void CodeGenManagerSettings::loadShouldCacheParsingResults(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "shouldCacheParsingResults", shouldCacheParsingResults, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load shouldCacheParsingResults: " + Helpers::toString(shouldCacheParsingResults));
+	}
+}
+
+void CodeGenManagerSettings::loadWorkerProcessCount(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "workerProcessCount", workerProcessCount, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load workerProcessCount: " + std::to_string(workerProcessCount));
+	}
+}
+
 std::unordered_set<fs::path, PathHash> const& CodeGenManagerSettings::getToProcessFiles() const noexcept
 {
 	return _toProcessFiles;
@@ -20,14 +20,11 @@ using namespace kodgen;
 CodeGenUnit::CodeGenUnit(CodeGenUnit const& other) noexcept:
 	_isCopy{true},
 	settings{other.settings},
-	logger{other.logger}
+	logger{other.logger},
+	projectStructClassTree{other.projectStructClassTree},
+	shouldKeepIdenticalGeneratedFiles{other.shouldKeepIdenticalGeneratedFiles}
 {
-	//Replace each module by a new clone of themself so that
-	//each CodeGenUnit instance owns their own modules
-	for (size_t i = 0; i < other._generationModules.size(); i++)
-	{
-		addModule(*static_cast<CodeGenModule*>(other._generationModules[i]->clone()));
-	}
+	cloneGenerationModules(other);
 }
 
 CodeGenUnit::~CodeGenUnit() noexcept
@@ -35,6 +32,11 @@ CodeGenUnit::~CodeGenUnit() noexcept
 	clearGenerationModules();
 }
 
+bool CodeGenUnit::hasGeneratedFiles(fs::path const& /* sourceFile */) const noexcept
+{
+	return true;
+}
+
 bool CodeGenUnit::checkSettings() const noexcept
 {
 	bool result = true;
@@ -196,35 +198,109 @@ ETraversalBehaviour	CodeGenUnit::generateCodeForEntityInternal(ICodeGenerator& c
 	return result;
 }
 
-void CodeGenUnit::sortedInsert(std::vector<ICodeGenerator*>& vector, ICodeGenerator& codeGen) noexcept
+void CodeGenUnit::updateSortedCodeGenerators() noexcept
 {
-	vector.insert
-	(
-		std::upper_bound(vector.begin(), vector.end(), &codeGen, [](ICodeGenerator const* lhs, ICodeGenerator const* rhs)
+	std::vector<SortedCodeGenerator> positions;
+
+	for (uint32 i = 0u; i < _generationModules.size(); i++)
+	{
+		positions.push_back(SortedCodeGenerator{i, -1});
+
+		for (int32 j = 0; j < static_cast<int32>(_generationModules[i]->getPropertyCodeGenerators().size()); j++)
 		{
-			return lhs->getGenerationOrder() < rhs->getGenerationOrder();
-		}),
-		&codeGen
-	);
+			positions.push_back(SortedCodeGenerator{i, j});
+		}
+	}
+
+	//Generation orders are only queried once, and stable sort keeps code generators with the same generation order in registration order
+	std::vector<int32> generationOrders;
+	generationOrders.reserve(positions.size());
+
+	for (SortedCodeGenerator const& position : positions)
+	{
+		CodeGenModule const* codeGenModule = _generationModules[position.moduleIndex];
+
+		generationOrders.push_back((position.propertyCodeGenIndex == -1) ?
+								   codeGenModule->getGenerationOrder() :
+								   codeGenModule->getPropertyCodeGenerators()[position.propertyCodeGenIndex]->getGenerationOrder());
+	}
+
+	std::vector<size_t> sortedIndices(positions.size());
+
+	for (size_t i = 0u; i < sortedIndices.size(); i++)
+	{
+		sortedIndices[i] = i;
+	}
+
+	std::stable_sort(sortedIndices.begin(), sortedIndices.end(), [&generationOrders](size_t lhs, size_t rhs)
+	{
+		return generationOrders[lhs] < generationOrders[rhs];
+	});
+
+	std::vector<SortedCodeGenerator> sortedPositions;
+	sortedPositions.reserve(positions.size());
+
+	for (size_t index : sortedIndices)
+	{
+		sortedPositions.push_back(positions[index]);
+	}
+
+	_sortedCodeGeneratorPositions = std::make_shared<std::vector<SortedCodeGenerator> const>(std::move(sortedPositions));
+
+	resolveSortedCodeGenerators();
 }
 
-std::vector<ICodeGenerator*> CodeGenUnit::getSortedCodeGenerators() const noexcept
+void CodeGenUnit::resolveSortedCodeGenerators() noexcept
 {
-	std::vector<ICodeGenerator*> result;
+	_sortedCodeGenerators.clear();
+
+	if (_sortedCodeGeneratorPositions == nullptr)
+	{
+		return;
+	}
+
+	_sortedCodeGenerators.reserve(_sortedCodeGeneratorPositions->size());
 
-	//Insert all code gen modules
-	for (CodeGenModule* codeGenModule : _generationModules)
+	for (SortedCodeGenerator const& position : *_sortedCodeGeneratorPositions)
 	{
-		sortedInsert(result, *codeGenModule);
+		assert(position.moduleIndex < _generationModules.size());
 
-		//Insert all property code gens contained in code gen modules
-		for (PropertyCodeGen* propertyCodeGen : codeGenModule->getPropertyCodeGenerators())
+		CodeGenModule* codeGenModule = _generationModules[position.moduleIndex];
+
+		if (position.propertyCodeGenIndex == -1)
+		{
+			_sortedCodeGenerators.push_back(codeGenModule);
+		}
+		else
 		{
-			sortedInsert(result, *propertyCodeGen);
+			//If you assert here, a cloned module doesn't register the same property code generators as the original module
+			assert(static_cast<size_t>(position.propertyCodeGenIndex) < codeGenModule->getPropertyCodeGenerators().size());
+
+			_sortedCodeGenerators.push_back(codeGenModule->getPropertyCodeGenerators()[position.propertyCodeGenIndex]);
 		}
 	}
+}
 
-	return result;
+void CodeGenUnit::cloneGenerationModules(CodeGenUnit const& other) noexcept
+{
+	//Replace each module by a new clone of themself so that
+	//each CodeGenUnit instance owns their own modules
+	_generationModules.reserve(other._generationModules.size());
+
+	for (CodeGenModule const* codeGenModule : other._generationModules)
+	{
+		_generationModules.push_back(static_cast<CodeGenModule*>(codeGenModule->clone()));
+	}
+
+	//Clones have the same generation orders, so reuse the order of the original modules
+	_sortedCodeGeneratorPositions = other._sortedCodeGeneratorPositions;
+
+	resolveSortedCodeGenerators();
+}
+
+std::vector<ICodeGenerator*> const& CodeGenUnit::getSortedCodeGenerators() const noexcept
+{
+	return _sortedCodeGenerators;
 }
 
 CodeGenEnv* CodeGenUnit::createCodeGenEnv() const noexcept
@@ -235,8 +311,9 @@ CodeGenEnv* CodeGenUnit::createCodeGenEnv() const noexcept
 bool CodeGenUnit::preGenerateCode(FileParsingResult const& parsingResult, CodeGenEnv& env) noexcept
 {
 	//Setup generation environment
-	env._fileParsingResult	= &parsingResult;
-	env._logger				= logger;
+	env._fileParsingResult		= &parsingResult;
+	env._logger					= logger;
+	env._projectStructClassTree	= projectStructClassTree;
 
 	return true;
 }
@@ -250,11 +327,38 @@ ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPair(std::function<ETravers
 {
 	assert(visitor != nullptr);
 
-	ETraversalBehaviour result;
+	if (settings != nullptr && settings->shouldTraverseEntitiesOnce)
+	{
+		return foreachCodeGenEntityPairSinglePass(visitor, env);
+	}
+
+	ETraversalBehaviour		result;
+	PropertyDispatchIndex	propertyDispatchIndex;
+	bool					isPropertyDispatchIndexFilled = false;
 
 	//Call visitor on all code generators
 	for (ICodeGenerator* codeGenerator : getSortedCodeGenerators())
 	{
+		//Property code generators which opted in only visit the entities carrying their property
+		PropertyCodeGen* propertyCodeGen = dynamic_cast<PropertyCodeGen*>(codeGenerator);
+
+		if (propertyCodeGen != nullptr && propertyCodeGen->usesPropertyDispatchIndex())
+		{
+			//Only build the index if at least one generator uses it
+			if (!isPropertyDispatchIndexFilled)
+			{
+				fillPropertyDispatchIndex(*env.getFileParsingResult(), propertyDispatchIndex);
+				isPropertyDispatchIndexFilled = true;
+			}
+
+			if (foreachPropertyCodeGenEntityPair(*propertyCodeGen, propertyDispatchIndex, env, visitor) == ETraversalBehaviour::AbortWithFailure)
+			{
+				return ETraversalBehaviour::AbortWithFailure;
+			}
+
+			continue;
+		}
+
 		for (NamespaceInfo const& namespace_ : env.getFileParsingResult()->namespaces)
 		{
 			result = foreachCodeGenEntityPairInNamespace(*codeGenerator, namespace_, env, visitor);
@@ -301,6 +405,394 @@ ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPair(std::function<ETravers
 	return ETraversalBehaviour::Recurse;
 }
 
+ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairSinglePass(std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor, CodeGenEnv& env) noexcept
+{
+	assert(visitor != nullptr);
+
+	std::vector<ICodeGenerator*> const&	codeGenerators = getSortedCodeGenerators();
+	std::vector<FlattenedEntity>		entities;
+
+	flattenEntities(*env.getFileParsingResult(), entities);
+
+	//Index of the next entity each code generator should visit, entities before it have been skipped by a Continue or Break
+	std::vector<uint32>	nextEntityIndices(codeGenerators.size(), 0u);
+	ETraversalBehaviour	result;
+
+	for (uint32 i = 0u; i < entities.size(); i++)
+	{
+		for (size_t j = 0u; j < codeGenerators.size(); j++)
+		{
+			if (i < nextEntityIndices[j])
+			{
+				continue;
+			}
+
+			result = codeGenerators[j]->callVisitorOnEntity(*entities[i].entity, env, visitor);
+
+			switch (result)
+			{
+				case ETraversalBehaviour::Continue:
+					nextEntityIndices[j] = entities[i].subtreeEnd;
+					break;
+
+				case ETraversalBehaviour::Break:
+					nextEntityIndices[j] = entities[i].siblingsEnd;
+					break;
+
+				case ETraversalBehaviour::AbortWithSuccess:
+					[[fallthrough]];
+				case ETraversalBehaviour::AbortWithFailure:
+					return result;
+
+				default:
+					//Recurse
+					break;
+			}
+		}
+	}
+
+	return ETraversalBehaviour::Recurse;
+}
+
+void CodeGenUnit::flattenEntities(FileParsingResult const& parsingResult, std::vector<FlattenedEntity>& out_entities) noexcept
+{
+	//Entities must be flattened in the same order as foreachCodeGenEntityPair traverses them
+	uint32 siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (NamespaceInfo const& namespace_ : parsingResult.namespaces)
+	{
+		flattenNamespace(namespace_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (StructClassInfo const& struct_ : parsingResult.structs)
+	{
+		flattenStruct(struct_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (StructClassInfo const& class_ : parsingResult.classes)
+	{
+		flattenStruct(class_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (EnumInfo const& enum_ : parsingResult.enums)
+	{
+		flattenEnum(enum_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (VariableInfo const& variable : parsingResult.variables)
+	{
+		flattenEntity(variable, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (FunctionInfo const& function : parsingResult.functions)
+	{
+		flattenEntity(function, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+}
+
+void CodeGenUnit::flattenEntity(EntityInfo const& entity, std::vector<FlattenedEntity>& out_entities) noexcept
+{
+	uint32 index = static_cast<uint32>(out_entities.size());
+
+	out_entities.push_back(FlattenedEntity{&entity, index + 1u, index + 1u});
+}
+
+void CodeGenUnit::flattenNamespace(NamespaceInfo const& namespace_, std::vector<FlattenedEntity>& out_entities) noexcept
+{
+	uint32 index = static_cast<uint32>(out_entities.size());
+
+	flattenEntity(namespace_, out_entities);
+
+	uint32 siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (NamespaceInfo const& nestedNamespace : namespace_.namespaces)
+	{
+		flattenNamespace(nestedNamespace, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (StructClassInfo const& struct_ : namespace_.structs)
+	{
+		flattenStruct(struct_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (StructClassInfo const& class_ : namespace_.classes)
+	{
+		flattenStruct(class_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (EnumInfo const& enum_ : namespace_.enums)
+	{
+		flattenEnum(enum_, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (VariableInfo const& variable : namespace_.variables)
+	{
+		flattenEntity(variable, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (FunctionInfo const& function : namespace_.functions)
+	{
+		flattenEntity(function, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+
+	out_entities[index].subtreeEnd = static_cast<uint32>(out_entities.size());
+}
+
+void CodeGenUnit::flattenStruct(StructClassInfo const& struct_, std::vector<FlattenedEntity>& out_entities) noexcept
+{
+	uint32 index = static_cast<uint32>(out_entities.size());
+
+	flattenEntity(struct_, out_entities);
+
+	uint32 siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : struct_.nestedStructs)
+	{
+		flattenStruct(*nestedStruct, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : struct_.nestedClasses)
+	{
+		flattenStruct(*nestedClass, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (NestedEnumInfo const& nestedEnum : struct_.nestedEnums)
+	{
+		flattenEnum(nestedEnum, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (FieldInfo const& field : struct_.fields)
+	{
+		flattenEntity(field, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+	siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (MethodInfo const& method : struct_.methods)
+	{
+		flattenEntity(method, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+
+	out_entities[index].subtreeEnd = static_cast<uint32>(out_entities.size());
+}
+
+void CodeGenUnit::flattenEnum(EnumInfo const& enum_, std::vector<FlattenedEntity>& out_entities) noexcept
+{
+	uint32 index = static_cast<uint32>(out_entities.size());
+
+	flattenEntity(enum_, out_entities);
+
+	uint32 siblingsStart = static_cast<uint32>(out_entities.size());
+
+	for (EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		flattenEntity(enumValue, out_entities);
+	}
+
+	closeFlattenedSiblings(siblingsStart, out_entities);
+
+	out_entities[index].subtreeEnd = static_cast<uint32>(out_entities.size());
+}
+
+void CodeGenUnit::closeFlattenedSiblings(uint32 siblingsStart, std::vector<FlattenedEntity>& inout_entities) noexcept
+{
+	uint32 siblingsEnd = static_cast<uint32>(inout_entities.size());
+
+	//Jump from sibling to sibling over their nested entities
+	for (uint32 i = siblingsStart; i < siblingsEnd; i = inout_entities[i].subtreeEnd)
+	{
+		inout_entities[i].siblingsEnd = siblingsEnd;
+	}
+}
+
+ETraversalBehaviour CodeGenUnit::foreachPropertyCodeGenEntityPair(PropertyCodeGen& propertyCodeGen, PropertyDispatchIndex const& index, CodeGenEnv& env,
+																  std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor) noexcept
+{
+	assert(visitor != nullptr);
+
+	auto it = index.find(propertyCodeGen.getPropertyName());
+
+	if (it != index.cend())
+	{
+		for (PropertyOccurrence const& occurrence : it->second)
+		{
+			if (propertyCodeGen.callVisitorOnProperty(*occurrence.entity, occurrence.propertyIndex, occurrence.enclosingEntityTypes, env, visitor) == ETraversalBehaviour::AbortWithFailure)
+			{
+				return ETraversalBehaviour::AbortWithFailure;
+			}
+		}
+	}
+
+	return ETraversalBehaviour::Recurse;
+}
+
+void CodeGenUnit::fillPropertyDispatchIndex(FileParsingResult const& parsingResult, PropertyDispatchIndex& out_index) noexcept
+{
+	//Entities must be added in the same order as foreachCodeGenEntityPair traverses them
+	for (NamespaceInfo const& namespace_ : parsingResult.namespaces)
+	{
+		addNamespaceToPropertyDispatchIndex(namespace_, EEntityType::Undefined, out_index);
+	}
+
+	for (StructClassInfo const& struct_ : parsingResult.structs)
+	{
+		addStructToPropertyDispatchIndex(struct_, EEntityType::Undefined, out_index);
+	}
+
+	for (StructClassInfo const& class_ : parsingResult.classes)
+	{
+		addStructToPropertyDispatchIndex(class_, EEntityType::Undefined, out_index);
+	}
+
+	for (EnumInfo const& enum_ : parsingResult.enums)
+	{
+		addEnumToPropertyDispatchIndex(enum_, EEntityType::Undefined, out_index);
+	}
+
+	for (VariableInfo const& variable : parsingResult.variables)
+	{
+		addToPropertyDispatchIndex(variable, EEntityType::Undefined, out_index);
+	}
+
+	for (FunctionInfo const& function : parsingResult.functions)
+	{
+		addToPropertyDispatchIndex(function, EEntityType::Undefined, out_index);
+	}
+}
+
+void CodeGenUnit::addToPropertyDispatchIndex(EntityInfo const& entity, EEntityType enclosingEntityTypes, PropertyDispatchIndex& out_index) noexcept
+{
+	for (uint8 i = 0; i < entity.properties.size(); i++)
+	{
+		out_index[entity.properties[i].name].push_back(PropertyOccurrence{&entity, i, enclosingEntityTypes});
+	}
+}
+
+void CodeGenUnit::addNamespaceToPropertyDispatchIndex(NamespaceInfo const& namespace_, EEntityType enclosingEntityTypes, PropertyDispatchIndex& out_index) noexcept
+{
+	addToPropertyDispatchIndex(namespace_, enclosingEntityTypes, out_index);
+
+	EEntityType nestedEnclosingEntityTypes = enclosingEntityTypes | EEntityType::Namespace;
+
+	for (NamespaceInfo const& nestedNamespace : namespace_.namespaces)
+	{
+		addNamespaceToPropertyDispatchIndex(nestedNamespace, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (StructClassInfo const& struct_ : namespace_.structs)
+	{
+		addStructToPropertyDispatchIndex(struct_, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (StructClassInfo const& class_ : namespace_.classes)
+	{
+		addStructToPropertyDispatchIndex(class_, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (EnumInfo const& enum_ : namespace_.enums)
+	{
+		addEnumToPropertyDispatchIndex(enum_, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (VariableInfo const& variable : namespace_.variables)
+	{
+		addToPropertyDispatchIndex(variable, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (FunctionInfo const& function : namespace_.functions)
+	{
+		addToPropertyDispatchIndex(function, nestedEnclosingEntityTypes, out_index);
+	}
+}
+
+void CodeGenUnit::addStructToPropertyDispatchIndex(StructClassInfo const& struct_, EEntityType enclosingEntityTypes, PropertyDispatchIndex& out_index) noexcept
+{
+	addToPropertyDispatchIndex(struct_, enclosingEntityTypes, out_index);
+
+	EEntityType nestedEnclosingEntityTypes = enclosingEntityTypes | struct_.entityType;
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : struct_.nestedStructs)
+	{
+		addStructToPropertyDispatchIndex(*nestedStruct, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : struct_.nestedClasses)
+	{
+		addStructToPropertyDispatchIndex(*nestedClass, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (NestedEnumInfo const& nestedEnum : struct_.nestedEnums)
+	{
+		addEnumToPropertyDispatchIndex(nestedEnum, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (FieldInfo const& field : struct_.fields)
+	{
+		addToPropertyDispatchIndex(field, nestedEnclosingEntityTypes, out_index);
+	}
+
+	for (MethodInfo const& method : struct_.methods)
+	{
+		addToPropertyDispatchIndex(method, nestedEnclosingEntityTypes, out_index);
+	}
+}
+
+void CodeGenUnit::addEnumToPropertyDispatchIndex(EnumInfo const& enum_, EEntityType enclosingEntityTypes, PropertyDispatchIndex& out_index) noexcept
+{
+	addToPropertyDispatchIndex(enum_, enclosingEntityTypes, out_index);
+
+	for (EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		addToPropertyDispatchIndex(enumValue, enclosingEntityTypes | EEntityType::Enum, out_index);
+	}
+}
+
 ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInNamespace(ICodeGenerator& codeGenerator, NamespaceInfo const& namespace_, CodeGenEnv& env,
 																	 std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor) noexcept
 {
@@ -448,12 +940,15 @@ void CodeGenUnit::clearGenerationModules() noexcept
 	}
 
 	_generationModules.clear();
+	_sortedCodeGeneratorPositions.reset();
+	_sortedCodeGenerators.clear();
 }
 
 void CodeGenUnit::addModule(CodeGenModule& generationModule) noexcept
 {
-	//Add modules sorted by generation order
 	_generationModules.emplace_back(&generationModule);
+
+	updateSortedCodeGenerators();
 }
 
 bool CodeGenUnit::removeModule(CodeGenModule const& generationModule) noexcept
@@ -464,6 +959,8 @@ bool CodeGenUnit::removeModule(CodeGenModule const& generationModule) noexcept
 	{
 		_generationModules.erase(it);
 
+		updateSortedCodeGenerators();
+
 		return true;
 	}
 
@@ -502,6 +999,8 @@ CodeGenUnit& CodeGenUnit::operator=(CodeGenUnit const& other) noexcept
 {
 	settings = other.settings;
 	logger = other.logger;
+	projectStructClassTree = other.projectStructClassTree;
+	shouldKeepIdenticalGeneratedFiles = other.shouldKeepIdenticalGeneratedFiles;
 
 	//Correctly release memory if the instance is already a copy
 	if (_isCopy)
@@ -516,12 +1015,7 @@ CodeGenUnit& CodeGenUnit::operator=(CodeGenUnit const& other) noexcept
 	//At this point, there should be no registered module
 	assert(_generationModules.empty());
 
-	//Replace each module by a new clone of themself so that
-	//each CodeGenUnit instance owns their own modules
-	for (size_t i = 0; i < other._generationModules.size(); i++)
-	{
-		addModule(*static_cast<CodeGenModule*>(other._generationModules[i]->clone()));
-	}
+	cloneGenerationModules(other);
 
 	return *this;
 }
\ No newline at end of file
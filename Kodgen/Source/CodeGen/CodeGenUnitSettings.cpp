@@ -2,6 +2,7 @@
 
 #include "Kodgen/Misc/TomlUtility.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/Helpers.h"
 
 using namespace kodgen;
 
@@ -12,6 +13,7 @@ bool CodeGenUnitSettings::loadSettingsValues(toml::value const& tomlData, ILogge
 		toml::value const& tomlGeneratorSettings = toml::find(tomlData, tomlSectionName);
 
 		loadOutputDirectory(tomlGeneratorSettings, logger);
+		loadShouldTraverseEntitiesOnce(tomlGeneratorSettings, logger);
 		
 		return true;
 	}
@@ -45,6 +47,14 @@ void CodeGenUnitSettings::loadOutputDirectory(toml::value const& generationSetti
 	}
 }
 
+void CodeGenUnitSettings::loadShouldTraverseEntitiesOnce(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "shouldTraverseEntitiesOnce", shouldTraverseEntitiesOnce, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load shouldTraverseEntitiesOnce: " + Helpers::toString(shouldTraverseEntitiesOnce));
+	}
+}
+
 fs::path const& CodeGenUnitSettings::getOutputDirectory() const noexcept
 {
 	return _outputDirectory;
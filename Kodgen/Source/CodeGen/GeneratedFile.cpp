@@ -1,27 +1,116 @@
 #include "Kodgen/CodeGen/GeneratedFile.h"
 
+#include <algorithm>	//std::equal
+#include <fstream>
+#include <iterator>	//std::istreambuf_iterator
+
 using namespace kodgen;
 
-GeneratedFile::GeneratedFile(fs::path&& generatedFilePath, fs::path const& sourceFilePath) noexcept:
+GeneratedFile::GeneratedFile(fs::path&& generatedFilePath, fs::path const& sourceFilePath, bool shouldKeepIdenticalContent, ILogger* logger) noexcept:
 	_path{std::forward<fs::path>(generatedFilePath)},
 	_sourceFilePath{sourceFilePath},
-	_streamToFile(_path.string(), std::ios::out | std::ios::trunc)
+	_shouldKeepIdenticalContent{shouldKeepIdenticalContent},
+	_logger{logger}
 {
 }
 
 GeneratedFile::~GeneratedFile() noexcept
 {
-	_streamToFile.close();
+	writeToDisk();
+}
+
+bool GeneratedFile::hasSameContentOnDisk() const noexcept
+{
+	std::error_code errorCode;
+	std::uintmax_t	fileSize = fs::file_size(_path, errorCode);
+
+	//Cheap size check first to avoid reading files which obviously changed
+	if (errorCode || fileSize != _content.size())
+	{
+		return false;
+	}
+
+	std::ifstream existingFile(_path, std::ios::in | std::ios::binary);
+
+	if (!existingFile.is_open())
+	{
+		return false;
+	}
+
+	return std::equal(_content.cbegin(), _content.cend(), std::istreambuf_iterator<char>(existingFile));
+}
+
+void GeneratedFile::writeToDisk() const noexcept
+{
+	std::error_code errorCode;
+
+	if (hasSameContentOnDisk())
+	{
+		if (_shouldKeepIdenticalContent)
+		{
+			return;
+		}
+
+		//The file must look as fresh as if it was rewritten, since it is newer than its source file only if its last write time is updated
+		fs::last_write_time(_path, fs::file_time_type::clock::now(), errorCode);
+
+		//Rewrite the file if it could not be touched
+		if (!errorCode)
+		{
+			return;
+		}
+	}
+
+	//Several generators might write the same file concurrently
+	fs::path tmpPath = FilesystemHelpers::makeTemporaryPath(_path);
+
+	bool isWritten;
+
+	{
+		std::ofstream tmpFile(tmpPath, std::ios::out | std::ios::trunc | std::ios::binary);
+
+		tmpFile.write(_content.data(), static_cast<std::streamsize>(_content.size()));
+		tmpFile.close();
+
+		isWritten = tmpFile.good();
+	}
+
+	if (!isWritten)
+	{
+		fs::remove(tmpPath, errorCode);
+
+		if (_logger != nullptr)
+		{
+			_logger->log("Failed to write the generated file " + _path.string() + ".", ILogger::ELogSeverity::Error);
+		}
+
+		return;
+	}
+
+	//fs::rename replaces the destination file if it already exists
+	fs::rename(tmpPath, _path, errorCode);
+
+	if (errorCode)
+	{
+		if (_logger != nullptr)
+		{
+			_logger->log("Failed to replace the generated file " + _path.string() + ": " + errorCode.message(), ILogger::ELogSeverity::Error);
+		}
+
+		fs::remove(tmpPath, errorCode);
+	}
 }
 
 void GeneratedFile::writeLine(std::string const& line) noexcept
 {
-	_streamToFile << line << "\n";
+	_content.append(line);
+	_content.push_back('\n');
 }
 
 void GeneratedFile::writeLine(std::string&& line) noexcept
 {
-	_streamToFile << std::forward<std::string>(line) << "\n";
+	_content.append(line);
+	_content.push_back('\n');
 }
 
 void GeneratedFile::writeLines(std::string const& line) noexcept
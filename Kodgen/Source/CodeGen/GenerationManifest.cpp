@@ -0,0 +1,286 @@
+#include "Kodgen/CodeGen/GenerationManifest.h"
+
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+using namespace kodgen;
+
+uint64 GenerationManifest::computeHash(std::string_view data, uint64 seed) noexcept
+{
+	constexpr uint64 fnvPrime = 1099511628211u;
+
+	for (char c : data)
+	{
+		seed ^= static_cast<uint8>(c);
+		seed *= fnvPrime;
+	}
+
+	return seed;
+}
+
+bool GenerationManifest::computeFileHash(fs::path const& file, uint64& out_hash) noexcept
+{
+	std::ifstream stream(file, std::ios::in | std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	char	buffer[64 * 1024];
+	uint64	hash = computeHash({});
+
+	while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0)
+	{
+		hash = computeHash(std::string_view(buffer, static_cast<size_t>(stream.gcount())), hash);
+	}
+
+	out_hash = hash;
+
+	return true;
+}
+
+bool GenerationManifest::getFileHash(fs::path const& file, uint64& out_hash) noexcept
+{
+	std::error_code	errorCode;
+	FileStamp		stamp;
+
+	stamp.size			= fs::file_size(file, errorCode);
+	stamp.lastWriteTime	= static_cast<int64>(fs::last_write_time(file, errorCode).time_since_epoch().count());
+
+	if (errorCode)
+	{
+		return false;
+	}
+
+	std::unique_lock lock(_mutex);
+
+	decltype(_fileStamps)::const_iterator it = _fileStamps.find(file);
+
+	if (it != _fileStamps.cend() && it->second.size == stamp.size && it->second.lastWriteTime == stamp.lastWriteTime)
+	{
+		out_hash = it->second.contentHash;
+
+		return true;
+	}
+
+	//Don't hold the lock while reading the file
+	lock.unlock();
+
+	if (!computeFileHash(file, stamp.contentHash))
+	{
+		return false;
+	}
+
+	lock.lock();
+
+	_fileStamps[file] = stamp;
+
+	out_hash = stamp.contentHash;
+
+	return true;
+}
+
+bool GenerationManifest::load(fs::path const& manifestFile, uint64 settingsHash) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_settingsHash = settingsHash;
+	_fileStamps.clear();
+	_sourceFileInputs.clear();
+
+	std::ifstream stream(manifestFile);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	std::string line;
+
+	if (!std::getline(stream, line) || line != _formatHeader)
+	{
+		return false;
+	}
+
+	std::vector<std::pair<fs::path, uint64>>*	currentSourceFileInputs	= nullptr;
+	bool										isSameSettings			= false;
+
+	while (std::getline(stream, line))
+	{
+		std::istringstream	lineStream(line);
+		std::string			recordType;
+		std::string			path;
+
+		lineStream >> recordType;
+
+		if (recordType == "settings")
+		{
+			uint64 loadedSettingsHash = 0u;
+
+			lineStream >> loadedSettingsHash;
+			isSameSettings = loadedSettingsHash == settingsHash;
+		}
+		else if (recordType == "stamp")
+		{
+			FileStamp stamp;
+
+			lineStream >> stamp.size >> stamp.lastWriteTime >> stamp.contentHash;
+			lineStream.ignore(1);
+			std::getline(lineStream, path);
+
+			_fileStamps[path] = stamp;
+		}
+		else if (recordType == "source" && isSameSettings)
+		{
+			lineStream.ignore(1);
+			std::getline(lineStream, path);
+
+			currentSourceFileInputs = &_sourceFileInputs[path];
+		}
+		else if (recordType == "input" && currentSourceFileInputs != nullptr)
+		{
+			uint64 contentHash = 0u;
+
+			lineStream >> contentHash;
+			lineStream.ignore(1);
+			std::getline(lineStream, path);
+
+			currentSourceFileInputs->emplace_back(path, contentHash);
+		}
+	}
+
+	return true;
+}
+
+bool GenerationManifest::save(fs::path const& manifestFile) const noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	//Write to a temporary file first so that an interrupted save never leaves a truncated manifest behind
+	fs::path		tmpPath = FilesystemHelpers::makeTemporaryPath(manifestFile);
+	std::ofstream	stream(tmpPath, std::ios::out | std::ios::trunc);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	stream << _formatHeader << "\n";
+	stream << "settings " << _settingsHash << "\n";
+
+	//Only save the stamps of files which are still inputs of a recorded source file
+	std::unordered_set<fs::path, PathHash> savedStamps;
+
+	for (auto const& [sourceFile, inputs] : _sourceFileInputs)
+	{
+		for (auto const& [inputFile, contentHash] : inputs)
+		{
+			decltype(_fileStamps)::const_iterator it = _fileStamps.find(inputFile);
+
+			if (it != _fileStamps.cend() && savedStamps.emplace(inputFile).second)
+			{
+				stream << "stamp " << it->second.size << " " << it->second.lastWriteTime << " " << it->second.contentHash << " " << inputFile.string() << "\n";
+			}
+		}
+	}
+
+	for (auto const& [sourceFile, inputs] : _sourceFileInputs)
+	{
+		stream << "source " << sourceFile.string() << "\n";
+
+		for (auto const& [inputFile, contentHash] : inputs)
+		{
+			stream << "input " << contentHash << " " << inputFile.string() << "\n";
+		}
+	}
+
+	stream.close();
+
+	std::error_code errorCode;
+
+	if (stream.fail())
+	{
+		fs::remove(tmpPath, errorCode);
+
+		return false;
+	}
+
+	//fs::rename replaces the manifest file if it already exists
+	fs::rename(tmpPath, manifestFile, errorCode);
+
+	if (errorCode)
+	{
+		fs::remove(tmpPath, errorCode);
+
+		return false;
+	}
+
+	return true;
+}
+
+bool GenerationManifest::isUpToDate(fs::path const& sourceFile) noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	decltype(_sourceFileInputs)::const_iterator it = _sourceFileInputs.find(sourceFile);
+
+	if (it == _sourceFileInputs.cend())
+	{
+		return false;
+	}
+
+	//Copy inputs since getFileHash locks the mutex
+	std::vector<std::pair<fs::path, uint64>> inputs = it->second;
+
+	lock.unlock();
+
+	uint64 currentHash;
+
+	for (auto const& [inputFile, recordedHash] : inputs)
+	{
+		if (!getFileHash(inputFile, currentHash) || currentHash != recordedHash)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void GenerationManifest::updateSourceFile(fs::path const& sourceFile, std::vector<fs::path> const& includedFiles) noexcept
+{
+	std::vector<std::pair<fs::path, uint64>>	inputs;
+	uint64										contentHash;
+
+	inputs.reserve(includedFiles.size() + 1u);
+
+	if (!getFileHash(sourceFile, contentHash))
+	{
+		removeSourceFile(sourceFile);
+
+		return;
+	}
+
+	inputs.emplace_back(sourceFile, contentHash);
+
+	for (fs::path const& includedFile : includedFiles)
+	{
+		if (getFileHash(includedFile, contentHash))
+		{
+			inputs.emplace_back(includedFile, contentHash);
+		}
+	}
+
+	std::lock_guard lock(_mutex);
+
+	_sourceFileInputs[sourceFile] = std::move(inputs);
+}
+
+void GenerationManifest::removeSourceFile(fs::path const& sourceFile) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_sourceFileInputs.erase(sourceFile);
+}
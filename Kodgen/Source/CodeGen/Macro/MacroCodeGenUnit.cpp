@@ -117,7 +117,7 @@ bool MacroCodeGenUnit::postGenerateCode(CodeGenEnv& env) noexcept
 
 void MacroCodeGenUnit::generateHeaderFile(MacroCodeGenEnv& env) noexcept
 {
-	GeneratedFile generatedHeader(getGeneratedHeaderFilePath(env.getFileParsingResult()->parsedFile), env.getFileParsingResult()->parsedFile);
+	GeneratedFile generatedHeader(getGeneratedHeaderFilePath(env.getFileParsingResult()->parsedFile), env.getFileParsingResult()->parsedFile, shouldKeepIdenticalGeneratedFiles, logger);
 
 	MacroCodeGenUnitSettings const* castSettings = getSettings();
 
@@ -152,7 +152,7 @@ void MacroCodeGenUnit::generateHeaderFile(MacroCodeGenEnv& env) noexcept
 
 void MacroCodeGenUnit::generateSourceFile(MacroCodeGenEnv& env) noexcept
 {
-	GeneratedFile generatedFile(getGeneratedSourceFilePath(env.getFileParsingResult()->parsedFile), env.getFileParsingResult()->parsedFile);
+	GeneratedFile generatedFile(getGeneratedSourceFilePath(env.getFileParsingResult()->parsedFile), env.getFileParsingResult()->parsedFile, shouldKeepIdenticalGeneratedFiles, logger);
 
 	generatedFile.writeLine("#pragma once\n");
 
@@ -181,6 +181,21 @@ bool MacroCodeGenUnit::isUpToDate(fs::path const& sourceFile) const noexcept
 	return false;
 }
 
+bool MacroCodeGenUnit::hasGeneratedFiles(fs::path const& sourceFile) const noexcept
+{
+	fs::path generatedHeaderPath = getGeneratedHeaderFilePath(sourceFile);
+
+	//If the generated header doesn't exist, create it and return false
+	if (!fs::exists(generatedHeaderPath))
+	{
+		GeneratedFile generatedHeader(fs::path(generatedHeaderPath), sourceFile);
+
+		return false;
+	}
+
+	return fs::exists(getGeneratedSourceFilePath(sourceFile));
+}
+
 void MacroCodeGenUnit::generateEntityClassFooterCode(EntityInfo const& entity, CodeGenEnv& env, std::function<void(EntityInfo const&, CodeGenEnv&, std::string&)> generate) noexcept
 {
 	if (entity.entityType == EEntityType::Struct || entity.entityType == EEntityType::Class)
@@ -0,0 +1,238 @@
+#include "Kodgen/CodeGen/ParsingResultCache.h"
+
+#include <fstream>
+#include <sstream>
+#include <iterator>	//std::istreambuf_iterator
+
+#include "Kodgen/CodeGen/GenerationManifest.h"
+#include "Kodgen/Parsing/ParsingResultWriter.h"
+#include "Kodgen/Parsing/ParsingResultReader.h"
+
+using namespace kodgen;
+
+fs::path ParsingResultCache::getEntryPath(fs::path const& file) const noexcept
+{
+	return _directory / (std::to_string(GenerationManifest::computeHash(file.string())) + _entryExtension);
+}
+
+bool ParsingResultCache::getFileHash(fs::path const& file, uint64& out_hash) noexcept
+{
+	std::error_code	errorCode;
+	FileStamp		stamp;
+
+	stamp.size			= fs::file_size(file, errorCode);
+	stamp.lastWriteTime	= static_cast<int64>(fs::last_write_time(file, errorCode).time_since_epoch().count());
+
+	if (errorCode)
+	{
+		return false;
+	}
+
+	std::unique_lock lock(_mutex);
+
+	decltype(_fileStamps)::const_iterator it = _fileStamps.find(file);
+
+	if (it != _fileStamps.cend() && it->second.size == stamp.size && it->second.lastWriteTime == stamp.lastWriteTime)
+	{
+		out_hash = it->second.contentHash;
+
+		return true;
+	}
+
+	//Don't hold the lock while reading the file
+	lock.unlock();
+
+	if (!GenerationManifest::computeFileHash(file, stamp.contentHash))
+	{
+		return false;
+	}
+
+	lock.lock();
+
+	_fileStamps[file] = stamp;
+
+	out_hash = stamp.contentHash;
+
+	return true;
+}
+
+bool ParsingResultCache::computeKey(fs::path const& file, std::vector<char const*> const& compilationArguments, EntryKey& out_key) noexcept
+{
+	uint64 contentHash;
+
+	//Take the time before reading the file, so that a write during the hash computation is detected by store
+	out_key.time = fs::file_time_type::clock::now();
+
+	if (!getFileHash(file, contentHash))
+	{
+		return false;
+	}
+
+	out_key.hash = GenerationManifest::computeHash(std::to_string(contentHash), _settingsHash);
+
+	for (char const* compilationArgument : compilationArguments)
+	{
+		//Hash the null terminator as well so that argument boundaries are part of the key
+		out_key.hash = GenerationManifest::computeHash(std::string_view(compilationArgument, std::char_traits<char>::length(compilationArgument) + 1u), out_key.hash);
+	}
+
+	return true;
+}
+
+bool ParsingResultCache::setup(fs::path const& directory, uint64 settingsHash) noexcept
+{
+	std::error_code errorCode;
+
+	_directory		= directory;
+	_settingsHash	= settingsHash;
+
+	fs::create_directories(_directory, errorCode);
+
+	return fs::is_directory(_directory, errorCode);
+}
+
+bool ParsingResultCache::load(fs::path const& file, EntryKey const& key, FileParsingResult& out_result) noexcept
+{
+	std::ifstream stream(getEntryPath(file), std::ios::in | std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	std::string	line;
+	bool		isSameKey = false;
+
+	if (!std::getline(stream, line) || line != _formatHeader)
+	{
+		return false;
+	}
+
+	//Header lines: key, source file, then an input line per included file, until the end line
+	while (std::getline(stream, line) && line != "end")
+	{
+		std::istringstream	lineStream(line);
+		std::string			recordType;
+		std::string			path;
+		uint64				recordedHash = 0u;
+		uint64				currentHash;
+
+		lineStream >> recordType;
+
+		if (recordType == "key")
+		{
+			lineStream >> recordedHash;
+
+			if (recordedHash != key.hash)
+			{
+				return false;
+			}
+
+			isSameKey = true;
+		}
+		else if (recordType == "source")
+		{
+			lineStream.ignore(1);
+			std::getline(lineStream, path);
+
+			//Different source files can share an entry path if their path hashes collide
+			if (path != file.string())
+			{
+				return false;
+			}
+		}
+		else if (recordType == "input")
+		{
+			lineStream >> recordedHash;
+			lineStream.ignore(1);
+			std::getline(lineStream, path);
+
+			if (!getFileHash(path, currentHash) || currentHash != recordedHash)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	if (line != "end" || !isSameKey)
+	{
+		return false;
+	}
+
+	std::string data(std::istreambuf_iterator<char>(stream), {});
+
+	return ParsingResultReader(data).read(out_result);
+}
+
+bool ParsingResultCache::store(fs::path const& file, EntryKey const& key, FileParsingResult const& result) noexcept
+{
+	std::ostringstream	header;
+	uint64				contentHash;
+	std::error_code		errorCode;
+
+	//The source file was written since its key was computed, so the parsing might have read a content not matching the key
+	if (fs::last_write_time(file, errorCode) >= key.time || errorCode)
+	{
+		return false;
+	}
+
+	header << _formatHeader << "\n";
+	header << "key " << key.hash << "\n";
+	header << "source " << file.string() << "\n";
+
+	for (fs::path const& includedFile : result.includedFiles)
+	{
+		//Included files are only known once parsed, so their hash is computed now: it only matches the parsed content
+		//if they were not written since the parsing started. An included file which can't be read anymore would
+		//make the entry invalid on load anyway
+		if (fs::last_write_time(includedFile, errorCode) >= key.time || errorCode || !getFileHash(includedFile, contentHash))
+		{
+			return false;
+		}
+
+		header << "input " << contentHash << " " << includedFile.string() << "\n";
+	}
+
+	header << "end\n";
+
+	ParsingResultWriter writer;
+
+	writer.write(result);
+
+	//Write to a temporary file first so that an interrupted write never leaves a truncated entry behind
+	//The temporary path is unique so that worker processes storing the same file don't write to the same temporary file
+	fs::path		entryPath	= getEntryPath(file);
+	fs::path		tmpPath		= FilesystemHelpers::makeTemporaryPath(entryPath);
+	std::ofstream	stream(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	stream << header.str();
+	stream.write(writer.getData().data(), static_cast<std::streamsize>(writer.getData().size()));
+	stream.close();
+
+	if (stream.fail())
+	{
+		fs::remove(tmpPath, errorCode);
+
+		return false;
+	}
+
+	fs::rename(tmpPath, entryPath, errorCode);
+
+	if (errorCode)
+	{
+		fs::remove(tmpPath, errorCode);
+
+		return false;
+	}
+
+	return true;
+}
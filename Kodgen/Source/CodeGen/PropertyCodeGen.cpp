@@ -20,9 +20,15 @@ bool PropertyCodeGen::shouldGenerateCodeForEntity(EntityInfo const& entity, Prop
 	return property.name == _propertyName && (entity.entityType && _eligibleEntityMask);
 }
 
-bool PropertyCodeGen::shouldIterateOnNestedEntities(EntityInfo const& entity) const noexcept
+bool PropertyCodeGen::usesPropertyDispatchIndex() const noexcept
 {
-	switch (entity.entityType)
+	//Overrides of shouldGenerateCodeForEntity may accept any property, so visit all entities by default
+	return false;
+}
+
+bool PropertyCodeGen::shouldIterateOnNestedEntities(EEntityType entityType) const noexcept
+{
+	switch (entityType)
 	{
 		case EEntityType::Namespace:
 			return NamespaceInfo::nestedEntityTypes && _eligibleEntityMask;
@@ -70,5 +76,40 @@ ETraversalBehaviour PropertyCodeGen::callVisitorOnEntity(EntityInfo const& entit
 		}
 	}
 
-	return shouldIterateOnNestedEntities(entity) ? ETraversalBehaviour::Recurse : ETraversalBehaviour::Continue;
+	return shouldIterateOnNestedEntities(entity.entityType) ? ETraversalBehaviour::Recurse : ETraversalBehaviour::Continue;
+}
+
+ETraversalBehaviour PropertyCodeGen::callVisitorOnProperty(EntityInfo const& entity, uint8 propertyIndex, EEntityType enclosingEntityTypes, CodeGenEnv& env,
+														   std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor) noexcept
+{
+	assert(visitor != nullptr);
+
+	static constexpr EEntityType enclosingEntityTypeCandidates[] = { EEntityType::Namespace, EEntityType::Struct, EEntityType::Class, EEntityType::Enum };
+
+	//A traversal doesn't reach entities nested in an entity this generator doesn't recurse on
+	for (EEntityType enclosingEntityType : enclosingEntityTypeCandidates)
+	{
+		if ((enclosingEntityTypes && enclosingEntityType) && !shouldIterateOnNestedEntities(enclosingEntityType))
+		{
+			return ETraversalBehaviour::Continue;
+		}
+	}
+
+	if (_eligibleEntityMask && entity.entityType)
+	{
+		AdditionalData data;
+
+		data.propertyIndex = propertyIndex;
+		data.property = &entity.properties[propertyIndex];
+
+		if (shouldGenerateCodeForEntity(entity, *data.property, data.propertyIndex))
+		{
+			if (visitor(*this, entity, env, &data) == ETraversalBehaviour::AbortWithFailure)
+			{
+				return ETraversalBehaviour::AbortWithFailure;
+			}
+		}
+	}
+
+	return ETraversalBehaviour::Recurse;
 }
\ No newline at end of file
@@ -0,0 +1,266 @@
+#include "Kodgen/CodeGen/ShardWorkerProcess.h"
+
+#include <cstring>	//std::memcpy
+#include <cstdio>	//std::fflush
+
+#if !_WIN32
+#include <cerrno>
+#include <csignal>		//signal, SIGPIPE
+#include <unistd.h>		//fork, pipe, read, write, close, _exit
+#include <poll.h>		//poll
+#include <sys/wait.h>	//waitpid
+#endif
+
+using namespace kodgen;
+
+ShardWorkerProcess::ShardWorkerProcess(ShardWorkerProcess&& other) noexcept:
+	_processId{other._processId},
+	_channel{other._channel},
+	_pendingData{std::move(other._pendingData)}
+{
+	other._processId	= -1;
+	other._channel		= -1;
+}
+
+ShardWorkerProcess::~ShardWorkerProcess() noexcept
+{
+	closeChannel();
+
+	//Don't leave a zombie process behind
+	if (_processId != -1)
+	{
+		wait();
+	}
+}
+
+bool ShardWorkerProcess::isSupported() noexcept
+{
+#if _WIN32
+	return false;
+#else
+	return true;
+#endif
+}
+
+void ShardWorkerProcess::closeChannel() noexcept
+{
+#if !_WIN32
+	if (_channel != -1)
+	{
+		close(_channel);
+		_channel = -1;
+	}
+#endif
+}
+
+bool ShardWorkerProcess::start([[maybe_unused]] WorkFunction const& work, [[maybe_unused]] std::vector<ShardWorkerProcess> const& startedWorkers) noexcept
+{
+#if _WIN32
+	return false;
+#else
+	int pipeEnds[2];
+
+	if (pipe(pipeEnds) != 0)
+	{
+		return false;
+	}
+
+	//Flush buffered output first, otherwise it would be written by both processes
+	std::fflush(nullptr);
+
+	pid_t processId = fork();
+
+	if (processId < 0)
+	{
+		close(pipeEnds[0]);
+		close(pipeEnds[1]);
+
+		return false;
+	}
+	else if (processId == 0)
+	{
+		close(pipeEnds[0]);
+
+		//Only the main process must hold the read end of the channels, so that a worker gets EPIPE once the main process stops listening
+		for (ShardWorkerProcess const& startedWorker : startedWorkers)
+		{
+			if (startedWorker._channel != -1)
+			{
+				close(startedWorker._channel);
+			}
+		}
+
+		//Report writes to a channel closed by the main process as errors instead of being killed by SIGPIPE
+		signal(SIGPIPE, SIG_IGN);
+
+		bool result = work(pipeEnds[1]);
+
+		close(pipeEnds[1]);
+		std::fflush(nullptr);
+
+		//Exit right away: objects copied from the main process (thread pool...) must not be destroyed by the worker
+		_exit(result ? 0 : 1);
+	}
+
+	close(pipeEnds[1]);
+
+	_processId	= processId;
+	_channel	= pipeEnds[0];
+
+	return true;
+#endif
+}
+
+bool ShardWorkerProcess::sendMessage([[maybe_unused]] int channel, [[maybe_unused]] std::string_view message) noexcept
+{
+#if _WIN32
+	return false;
+#else
+	uint64	messageSize = message.size();
+	char	sizePrefix[sizeof(uint64)];
+
+	std::memcpy(sizePrefix, &messageSize, sizeof(uint64));
+
+	for (std::string_view data : { std::string_view(sizePrefix, sizeof(uint64)), message })
+	{
+		while (!data.empty())
+		{
+			ssize_t writtenSize = write(channel, data.data(), data.size());
+
+			if (writtenSize < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return false;
+			}
+
+			data.remove_prefix(static_cast<size_t>(writtenSize));
+		}
+	}
+
+	return true;
+#endif
+}
+
+bool ShardWorkerProcess::receive([[maybe_unused]] MessageHandler const& onMessage) noexcept
+{
+#if _WIN32
+	return false;
+#else
+	constexpr size_t const bufferSize = 65536u;
+
+	char	buffer[bufferSize];
+	ssize_t	readSize = read(_channel, buffer, bufferSize);
+
+	if (readSize < 0)
+	{
+		return errno == EINTR;
+	}
+	else if (readSize == 0)
+	{
+		return false;
+	}
+
+	_pendingData.append(buffer, static_cast<size_t>(readSize));
+
+	size_t	offset = 0u;
+	uint64	messageSize;
+
+	while (_pendingData.size() - offset >= sizeof(uint64))
+	{
+		std::memcpy(&messageSize, _pendingData.data() + offset, sizeof(uint64));
+
+		if (_pendingData.size() - offset - sizeof(uint64) < messageSize)
+		{
+			break;
+		}
+
+		onMessage(std::string_view(_pendingData.data() + offset + sizeof(uint64), static_cast<size_t>(messageSize)));
+
+		offset += sizeof(uint64) + static_cast<size_t>(messageSize);
+	}
+
+	_pendingData.erase(0u, offset);
+
+	return true;
+#endif
+}
+
+void ShardWorkerProcess::receiveMessages([[maybe_unused]] std::vector<ShardWorkerProcess>& workers, [[maybe_unused]] MessageHandler const& onMessage) noexcept
+{
+#if !_WIN32
+	std::vector<pollfd>					pollChannels;
+	std::vector<ShardWorkerProcess*>	pollWorkers;
+
+	while (true)
+	{
+		pollChannels.clear();
+		pollWorkers.clear();
+
+		for (ShardWorkerProcess& worker : workers)
+		{
+			if (worker._channel != -1)
+			{
+				pollChannels.push_back(pollfd{ worker._channel, POLLIN, 0 });
+				pollWorkers.push_back(&worker);
+			}
+		}
+
+		if (pollChannels.empty())
+		{
+			break;
+		}
+
+		if (poll(pollChannels.data(), static_cast<nfds_t>(pollChannels.size()), -1) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			//Stop listening: once their channel is closed, the pending and next writes of the workers fail with EPIPE
+			for (ShardWorkerProcess* worker : pollWorkers)
+			{
+				worker->closeChannel();
+			}
+
+			break;
+		}
+
+		for (size_t i = 0u; i < pollChannels.size(); i++)
+		{
+			if (pollChannels[i].revents != 0 && !pollWorkers[i]->receive(onMessage))
+			{
+				pollWorkers[i]->closeChannel();
+			}
+		}
+	}
+#endif
+}
+
+bool ShardWorkerProcess::wait() noexcept
+{
+#if _WIN32
+	return false;
+#else
+	if (_processId == -1)
+	{
+		return false;
+	}
+
+	int		status = 0;
+	pid_t	result;
+
+	do
+	{
+		result = waitpid(static_cast<pid_t>(_processId), &status, 0);
+	} while (result < 0 && errno == EINTR);
+
+	_processId = -1;
+
+	return result >= 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0 && _pendingData.empty();
+#endif
+}
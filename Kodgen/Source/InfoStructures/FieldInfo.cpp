@@ -4,6 +4,15 @@
 
 using namespace kodgen;
 
+FieldInfo::FieldInfo() noexcept:
+	VariableInfo(),
+	isMutable{false},
+	accessSpecifier{EAccessSpecifier::Invalid},
+	memoryOffset{0}
+{
+	entityType = EEntityType::Field;
+}
+
 FieldInfo::FieldInfo(CXCursor const& cursor, std::vector<Property>&& properties) noexcept:
 	VariableInfo(cursor, std::forward<std::vector<Property>>(properties), EEntityType::Field),
 	isMutable{clang_CXXField_isMutable(cursor) != 0u},
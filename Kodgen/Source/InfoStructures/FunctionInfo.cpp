@@ -7,6 +7,14 @@
 
 using namespace kodgen;
 
+FunctionInfo::FunctionInfo() noexcept:
+	EntityInfo(),
+	isInline{false},
+	isStatic{false}
+{
+	entityType = EEntityType::Function;
+}
+
 FunctionInfo::FunctionInfo(CXCursor const& cursor, std::vector<Property>&& properties, EEntityType entityType) noexcept:
 	EntityInfo(cursor, std::forward<std::vector<Property>>(properties), entityType),
 	isInline{clang_Cursor_isFunctionInlined(cursor) != 0u},
@@ -7,6 +7,19 @@
 
 using namespace kodgen;
 
+MethodInfo::MethodInfo() noexcept:
+	FunctionInfo(),
+	accessSpecifier{EAccessSpecifier::Invalid},
+	isDefault{false},
+	isVirtual{false},
+	isPureVirtual{false},
+	isOverride{false},
+	isFinal{false},
+	isConst{false}
+{
+	entityType = EEntityType::Method;
+}
+
 MethodInfo::MethodInfo(CXCursor const& cursor, std::vector<Property>&& properties) noexcept:
 	FunctionInfo(cursor, std::forward<std::vector<Property>>(properties), EEntityType::Method),
 	accessSpecifier{EAccessSpecifier::Invalid},
@@ -2,6 +2,12 @@
 
 using namespace kodgen;
 
+NamespaceInfo::NamespaceInfo() noexcept:
+	EntityInfo()
+{
+	entityType = EEntityType::Namespace;
+}
+
 NamespaceInfo::NamespaceInfo(CXCursor const& cursor, std::vector<Property>&& properties) noexcept:
 	EntityInfo(cursor, std::forward<std::vector<Property>>(properties), EEntityType::Namespace)
 {
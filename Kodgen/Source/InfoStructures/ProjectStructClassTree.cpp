@@ -0,0 +1,98 @@
+#include "Kodgen/InfoStructures/ProjectStructClassTree.h"
+
+#include <mutex>	//std::unique_lock
+
+using namespace kodgen;
+
+void ProjectStructClassTree::updateFile(fs::path const& file, StructClassTree const& fileStructClassTree) noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	auto [it, isNewFile] = _fileStructClassTrees.try_emplace(file, fileStructClassTree);
+
+	if (isNewFile)
+	{
+		//Links can only be added to the merged tree, so the contribution of a new file is merged directly.
+		if (!_isMergedTreeDirty)
+		{
+			_mergedStructClassTree.merge(fileStructClassTree);
+		}
+	}
+	else
+	{
+		//The previous contribution of the file can't be removed from the merged tree
+		it->second			= fileStructClassTree;
+		_isMergedTreeDirty	= true;
+	}
+}
+
+void ProjectStructClassTree::removeFile(fs::path const& file) noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	_isMergedTreeDirty |= _fileStructClassTrees.erase(file) != 0u;
+}
+
+void ProjectStructClassTree::clear() noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	_fileStructClassTrees.clear();
+	_mergedStructClassTree	= StructClassTree();
+	_isMergedTreeDirty		= false;
+}
+
+void ProjectStructClassTree::refreshMergedTree() const noexcept
+{
+	if (_isMergedTreeDirty)
+	{
+		_mergedStructClassTree = StructClassTree();
+
+		for (auto const& [file, fileStructClassTree] : _fileStructClassTrees)
+		{
+			_mergedStructClassTree.merge(fileStructClassTree);
+		}
+
+		_isMergedTreeDirty = false;
+	}
+
+	_mergedStructClassTree.build();
+}
+
+void ProjectStructClassTree::build() noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	refreshMergedTree();
+}
+
+bool ProjectStructClassTree::isBaseOf(std::string const& baseStructClassName, std::string const& childStructClassName, EAccessSpecifier* out_inheritanceAccess) const noexcept
+{
+	{
+		std::shared_lock lock(_mutex);
+
+		if (!_isMergedTreeDirty)
+		{
+			return _mergedStructClassTree.isBaseOf(baseStructClassName, childStructClassName, out_inheritanceAccess);
+		}
+	}
+
+	std::unique_lock lock(_mutex);
+
+	//Another thread might have rebuilt the tree in the meantime
+	if (_isMergedTreeDirty)
+	{
+		refreshMergedTree();
+	}
+
+	return _mergedStructClassTree.isBaseOf(baseStructClassName, childStructClassName, out_inheritanceAccess);
+}
+
+StructClassTree ProjectStructClassTree::getSnapshot() const noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	refreshMergedTree();
+
+	return _mergedStructClassTree;
+}
\ No newline at end of file
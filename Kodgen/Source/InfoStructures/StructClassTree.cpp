@@ -1,21 +1,43 @@
 #include "Kodgen/InfoStructures/StructClassTree.h"
 
 #include <cassert>
-#include <algorithm> //std::none_of
-#include <queue>
+#include <algorithm> //std::none_of, std::sort, std::lower_bound
 
 using namespace kodgen;
 
+StructClassTree::NodeId StructClassTree::getOrAddNode(std::string const& structClassName) noexcept
+{
+	auto it = _nodeIds.find(structClassName);
+
+	if (it != _nodeIds.cend())
+	{
+		return it->second;
+	}
+
+	NodeId					nodeId		= static_cast<NodeId>(_nodeNames.size());
+	InternedString const&	nodeName	= _nodeNames.emplace_back(structClassName);
+
+	//Key views the interned string which is stable, unlike the provided one
+	_nodeIds.emplace(nodeName.str(), nodeId);
+	_parents.emplace_back();
+
+	_isBuilt = false;
+
+	return nodeId;
+}
+
 bool StructClassTree::addInheritanceLink(std::string const& childStructClassName, std::string const& parentStructClassName, EAccessSpecifier inheritanceAccess) noexcept
 {
 	//Create child and parent structs entries if they don't exist yet
-	entries.emplace(parentStructClassName, std::vector<StructClassTree::InheritanceLink>());
-	std::vector<StructClassTree::InheritanceLink>& childInheritanceLinks = entries.emplace(childStructClassName, std::vector<StructClassTree::InheritanceLink>()).first->second;
+	NodeId							parentNode				= getOrAddNode(parentStructClassName);
+	std::vector<InheritanceLink>&	childInheritanceLinks	= _parents[getOrAddNode(childStructClassName)];
 
 	//If the inheritance link doesn't exist yet, create it
-	if (std::none_of(childInheritanceLinks.begin(), childInheritanceLinks.end(), [&parentStructClassName](StructClassTree::InheritanceLink const& link){ return link.inheritedStructClassName == parentStructClassName; }))
+	if (std::none_of(childInheritanceLinks.begin(), childInheritanceLinks.end(), [parentNode](InheritanceLink const& link){ return link.inheritedStructClass == parentNode; }))
 	{
-		childInheritanceLinks.emplace_back(StructClassTree::InheritanceLink{ parentStructClassName, inheritanceAccess });
+		childInheritanceLinks.emplace_back(InheritanceLink{ parentNode, inheritanceAccess });
+
+		_isBuilt = false;
 
 		return true;
 	}
@@ -23,68 +45,143 @@ bool StructClassTree::addInheritanceLink(std::string const& childStructClassName
 	return false;
 }
 
+void StructClassTree::merge(StructClassTree const& other) noexcept
+{
+	for (NodeId otherNode = 0u; otherNode < other._nodeNames.size(); otherNode++)
+	{
+		std::string const& otherNodeName = other._nodeNames[otherNode];
+
+		//Nodes without any parent must be merged too
+		getOrAddNode(otherNodeName);
+
+		for (InheritanceLink const& inheritanceLink : other._parents[otherNode])
+		{
+			addInheritanceLink(otherNodeName, other._nodeNames[inheritanceLink.inheritedStructClass], inheritanceLink.inheritanceAccess);
+		}
+	}
+}
+
+void StructClassTree::build() noexcept
+{
+	if (_isBuilt)
+	{
+		return;
+	}
+
+	_ancestors.clear();
+	_ancestorsOffsets.clear();
+	_ancestorsOffsets.reserve(_parents.size() + 1u);
+
+	for (NodeId node = 0u; node < _parents.size(); node++)
+	{
+		_ancestorsOffsets.push_back(static_cast<uint32>(_ancestors.size()));
+
+		//Keep the access of the first link reaching each ancestor, like a traversal of the hierarchy would
+		foreachAncestorLink(node, [this](InheritanceLink const& inheritanceLink)
+							{
+								_ancestors.push_back(inheritanceLink);
+
+								return false;
+							});
+
+		std::sort(_ancestors.begin() + _ancestorsOffsets.back(), _ancestors.end(), [](InheritanceLink const& lhs, InheritanceLink const& rhs)
+				  {
+					  return lhs.inheritedStructClass < rhs.inheritedStructClass;
+				  });
+	}
+
+	_ancestorsOffsets.push_back(static_cast<uint32>(_ancestors.size()));
+
+	_isBuilt = true;
+}
+
 bool StructClassTree::isBaseOf(std::string const& baseStructClassName, std::string const& childStructClassName, EAccessSpecifier* out_inheritanceAccess) const noexcept
 {
-	decltype(entries)::const_iterator childEntry = entries.find(childStructClassName);
+	return isBaseOf(findNode(baseStructClassName), findNode(childStructClassName), out_inheritanceAccess);
+}
 
-	//Make sure the childStruct is registered to the tree
-	if (childEntry != entries.cend())
+bool StructClassTree::isBaseOf(NodeId baseNode, NodeId childNode, EAccessSpecifier* out_inheritanceAccess) const noexcept
+{
+	//Make sure both structs are registered to the tree
+	if (baseNode == invalidNodeId || childNode == invalidNodeId)
 	{
-		//If the base class is the same as the child class, it is a valid base
-		if (baseStructClassName == childStructClassName)
-		{
-			//Fill out_inheritanceAccess if possible
-			if (out_inheritanceAccess != nullptr)
-			{
-				*out_inheritanceAccess = EAccessSpecifier::Invalid;
-			}
+		return false;
+	}
 
-			return true;
+	//If the base class is the same as the child class, it is a valid base
+	if (baseNode == childNode)
+	{
+		//Fill out_inheritanceAccess if possible
+		if (out_inheritanceAccess != nullptr)
+		{
+			*out_inheritanceAccess = EAccessSpecifier::Invalid;
 		}
-		//Make sure the base class exists in the tree before we continue any further
-		else if (entries.find(baseStructClassName) != entries.cend())
+
+		return true;
+	}
+
+	InheritanceLink const*	foundLink = nullptr;
+
+	if (_isBuilt)
+	{
+		//Binary search in the precomputed ancestors
+		auto ancestorsBegin	= _ancestors.cbegin() + _ancestorsOffsets[childNode];
+		auto ancestorsEnd	= _ancestors.cbegin() + _ancestorsOffsets[childNode + 1u];
+		auto it				= std::lower_bound(ancestorsBegin, ancestorsEnd, baseNode, [](InheritanceLink const& link, NodeId node)
+											   {
+												   return link.inheritedStructClass < node;
+											   });
+
+		if (it != ancestorsEnd && it->inheritedStructClass == baseNode)
 		{
-			std::queue<decltype(entries)::const_iterator> toCheck;
-			toCheck.push(childEntry);
-
-			decltype(entries)::const_iterator currentEntry;
-
-			//Traverse the parents of childStruct recursively until we find the base class
-			while (!toCheck.empty())
-			{
-				currentEntry = toCheck.front();
-				toCheck.pop();
-
-				for (StructClassTree::InheritanceLink const& inheritanceLink : currentEntry->second)
-				{
-					//All inheritance links should point to a valid struct/class.
-					assert(entries.find(inheritanceLink.inheritedStructClassName) != entries.cend());
-
-					//If the name matches baseStructClass is a valid base class
-					if (inheritanceLink.inheritedStructClassName == baseStructClassName)
-					{
-						//Fill out_inheritanceAccess if possible
-						if (out_inheritanceAccess != nullptr)
-						{
-							*out_inheritanceAccess = inheritanceLink.inheritanceAccess;
-						}
-
-						return true;
-					}
-					else
-					{
-						//Recurse on the tested entry parents
-						toCheck.push(entries.find(inheritanceLink.inheritedStructClassName));
-					}
-				}
-			}
+			foundLink = &*it;
 		}
 	}
+	else
+	{
+		//Links were added since the last build, traverse the hierarchy
+		foreachAncestorLink(childNode, [baseNode, &foundLink](InheritanceLink const& inheritanceLink)
+							{
+								if (inheritanceLink.inheritedStructClass == baseNode)
+								{
+									foundLink = &inheritanceLink;
+								}
 
-	return false;
+								return foundLink != nullptr;
+							});
+	}
+
+	//Fill out_inheritanceAccess if possible
+	if (foundLink != nullptr && out_inheritanceAccess != nullptr)
+	{
+		*out_inheritanceAccess = foundLink->inheritanceAccess;
+	}
+
+	return foundLink != nullptr;
+}
+
+StructClassTree::NodeId StructClassTree::findNode(std::string_view structClassName) const noexcept
+{
+	auto it = _nodeIds.find(structClassName);
+
+	return (it != _nodeIds.cend()) ? it->second : invalidNodeId;
+}
+
+InternedString const& StructClassTree::getNodeName(NodeId node) const noexcept
+{
+	assert(node < _nodeNames.size());
+
+	return _nodeNames[node];
+}
+
+std::vector<StructClassTree::InheritanceLink> const& StructClassTree::getParents(NodeId node) const noexcept
+{
+	assert(node < _parents.size());
+
+	return _parents[node];
 }
 
-std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> const& StructClassTree::getEntries() const noexcept
+size_t StructClassTree::getNodeCount() const noexcept
 {
-	return entries;
+	return _nodeNames.size();
 }
\ No newline at end of file
@@ -7,6 +7,11 @@
 
 using namespace kodgen;
 
+TemplateParamInfo::TemplateParamInfo() noexcept:
+	kind{ETemplateParameterKind::Undefined}
+{
+}
+
 TemplateParamInfo::TemplateParamInfo(CXCursor cursor) noexcept:
 	kind{getTemplateParamKind(cursor.kind)},
 	type{std::make_unique<TypeInfo>(cursor)},
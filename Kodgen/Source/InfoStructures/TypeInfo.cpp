@@ -27,8 +27,8 @@ void TypeInfo::initialize(CXType cursorType) noexcept
 
 	assert(canonicalType.kind != CXTypeKind::CXType_Invalid);
 
-	_fullName			= Helpers::getString(clang_getTypeSpelling(cursorType));
-	_canonicalFullName	= Helpers::getString(clang_getTypeSpelling(canonicalType));
+	std::string fullName	= Helpers::getString(clang_getTypeSpelling(cursorType));
+	_canonicalFullName		= Helpers::getString(clang_getTypeSpelling(canonicalType));
 
 	long long size		= clang_Type_getSizeOf(cursorType);
 
@@ -44,7 +44,9 @@ void TypeInfo::initialize(CXType cursorType) noexcept
 	}
 
 	//Remove class or struct keyword
-	removeForwardDeclaredClassQualifier(_fullName);
+	removeForwardDeclaredClassQualifier(fullName);
+
+	_fullName = fullName;
 
 	//Fill the descriptors vector
 	TypePart*	currTypePart;
@@ -4,6 +4,13 @@
 
 using namespace kodgen;
 
+VariableInfo::VariableInfo() noexcept:
+	EntityInfo(),
+	isStatic{false}
+{
+	entityType = EEntityType::Variable;
+}
+
 VariableInfo::VariableInfo(CXCursor const& cursor, std::vector<Property>&& properties, EEntityType entityType) noexcept:
 	EntityInfo(cursor, std::forward<std::vector<Property>>(properties), entityType),
 	isStatic{false},
@@ -4,6 +4,8 @@
 #include <cctype>		//std::tolower
 #include <sstream>		//std::stringstream
 #include <algorithm>	//std::transform
+#include <fstream>
+#include <functional>	//std::hash
 
 #if _WIN32
 #include <Windows.h>	//GetModuleFileNameA, GetLastError, ERROR_INSUFFICIENT_BUFFER
@@ -17,13 +19,33 @@ bool CompilerHelpers::isSupportedCompiler(std::string const& compiler) noexcept
 {
 	std::string normalizedCompilerExecutable = normalizeCompilerExeName(compiler);
 
-	return 
 #if _WIN32
-		//Check MSVC only on windows platform
-		(isMSVC(normalizedCompilerExecutable) && isMSVCSupported()) ||
+	//Check MSVC only on windows platform
+	if (isMSVC(normalizedCompilerExecutable))
+	{
+		return isMSVCSupported();
+	}
 #endif
-		(isClang(normalizedCompilerExecutable) && isClangSupported(normalizedCompilerExecutable)) ||
-		(isGCC(normalizedCompilerExecutable) && isGCCSupported(normalizedCompilerExecutable));
+
+	if (isClang(normalizedCompilerExecutable) || isGCC(normalizedCompilerExecutable))
+	{
+		CachedCompilerInfo compilerInfo = loadCachedCompilerInfo(normalizedCompilerExecutable);
+
+		if (!compilerInfo.isSupported.has_value())
+		{
+			compilerInfo.isSupported = isClang(normalizedCompilerExecutable) ? isClangSupported(normalizedCompilerExecutable) : isGCCSupported(normalizedCompilerExecutable);
+
+			//Don't cache failures, which may be transient (compiler being installed, broken PATH...)
+			if (*compilerInfo.isSupported)
+			{
+				saveCachedCompilerInfo(normalizedCompilerExecutable, compilerInfo);
+			}
+		}
+
+		return *compilerInfo.isSupported;
+	}
+
+	return false;
 }
 
 bool CompilerHelpers::isGCCSupported(std::string const& gccExeName) noexcept
@@ -103,6 +125,11 @@ bool CompilerHelpers::isGCC(std::string const& normalizedCompilerExeName) noexce
 			normalizedCompilerExeName.substr(0u, gccCompilerName2.size()) == gccCompilerName2;
 }
 
+std::string CompilerHelpers::getCompilerStamp(std::string const& compilerExeName) noexcept
+{
+	return computeCompilerStamp(normalizeCompilerExeName(compilerExeName));
+}
+
 std::vector<fs::path> CompilerHelpers::getCompilerNativeIncludeDirectories(std::string const& compiler)
 {
 	std::vector<fs::path> result;
@@ -120,15 +147,23 @@ std::vector<fs::path> CompilerHelpers::getCompilerNativeIncludeDirectories(std::
 		}
 #endif
 
-		//Check clang
-		if (isClang(normalizedCompilerExeName))
+		//Check clang and GCC
+		if (isClang(normalizedCompilerExeName) || isGCC(normalizedCompilerExeName))
 		{
-			return getClangNativeIncludeDirectories(normalizedCompilerExeName);
-		}
-		//Check GCC
-		else if (isGCC(normalizedCompilerExeName))
-		{
-			return getGCCNativeIncludeDirectories(normalizedCompilerExeName);
+			CachedCompilerInfo compilerInfo = loadCachedCompilerInfo(normalizedCompilerExeName);
+
+			if (!compilerInfo.nativeIncludeDirectories.has_value())
+			{
+				//Query failures throw, so they are never cached
+				compilerInfo.nativeIncludeDirectories = isClang(normalizedCompilerExeName) ? getClangNativeIncludeDirectories(normalizedCompilerExeName) : getGCCNativeIncludeDirectories(normalizedCompilerExeName);
+
+				if (!compilerInfo.nativeIncludeDirectories->empty())
+				{
+					saveCachedCompilerInfo(normalizedCompilerExeName, compilerInfo);
+				}
+			}
+
+			return std::move(*compilerInfo.nativeIncludeDirectories);
 		}
 	}
 
@@ -259,6 +294,158 @@ std::string CompilerHelpers::normalizeCompilerExeName(std::string const& compile
 	return result;
 }
 
+std::string CompilerHelpers::computeCompilerStamp(std::string const& normalizedCompilerExeName) noexcept
+{
+	fs::path compilerPath = System::findExecutable(normalizedCompilerExeName);
+
+	if (compilerPath.empty())
+	{
+		return std::string();
+	}
+
+	std::error_code	errorCode;
+	auto			lastWriteTime	= fs::last_write_time(compilerPath, errorCode);
+	std::uintmax_t	fileSize		= errorCode ? 0u : fs::file_size(compilerPath, errorCode);
+
+	if (errorCode)
+	{
+		return std::string();
+	}
+
+	return compilerPath.string() + "|" + std::to_string(lastWriteTime.time_since_epoch().count()) + "|" + std::to_string(fileSize);
+}
+
+fs::path CompilerHelpers::getCompilerCacheFilePath(std::string const& normalizedCompilerExeName) noexcept
+{
+	fs::path cacheDirectory = System::getUserCacheDirectory();
+
+	if (cacheDirectory.empty())
+	{
+		return fs::path();
+	}
+
+	return cacheDirectory / ("Compiler_" + std::to_string(std::hash<std::string>()(normalizedCompilerExeName)) + ".txt");
+}
+
+CompilerHelpers::CachedCompilerInfo CompilerHelpers::loadCachedCompilerInfo(std::string const& normalizedCompilerExeName) noexcept
+{
+	CachedCompilerInfo result;
+
+	result.stamp = computeCompilerStamp(normalizedCompilerExeName);
+
+	if (result.stamp.empty())
+	{
+		return result;
+	}
+
+	std::ifstream cacheFile(getCompilerCacheFilePath(normalizedCompilerExeName));
+
+	if (!cacheFile.is_open())
+	{
+		return result;
+	}
+
+	std::string line;
+
+	//Discard the whole file if the format changed or if the compiler binary changed
+	if (!std::getline(cacheFile, line) || line != cacheFileHeader ||
+		!std::getline(cacheFile, line) || line != "stamp " + result.stamp)
+	{
+		return result;
+	}
+
+	while (std::getline(cacheFile, line))
+	{
+		if (line.rfind("supported ", 0u) == 0u)
+		{
+			//Failures are not cached, but might have been by previous versions
+			if (line.substr(10u) == "1")
+			{
+				result.isSupported = true;
+			}
+		}
+		else if (line.rfind("includeDirs ", 0u) == 0u)
+		{
+			size_t					includeDirsCount = 0u;
+			std::vector<fs::path>	includeDirs;
+
+			if (!(std::stringstream(line.substr(12u)) >> includeDirsCount))
+			{
+				break;
+			}
+
+			includeDirs.reserve(includeDirsCount);
+
+			while (includeDirs.size() < includeDirsCount && std::getline(cacheFile, line))
+			{
+				includeDirs.emplace_back(line);
+			}
+
+			//Only keep complete lists
+			if (includeDirs.size() == includeDirsCount)
+			{
+				result.nativeIncludeDirectories = std::move(includeDirs);
+			}
+		}
+	}
+
+	return result;
+}
+
+void CompilerHelpers::saveCachedCompilerInfo(std::string const& normalizedCompilerExeName, CachedCompilerInfo const& compilerInfo) noexcept
+{
+	if (compilerInfo.stamp.empty())
+	{
+		return;
+	}
+
+	fs::path cacheFilePath = getCompilerCacheFilePath(normalizedCompilerExeName);
+
+	if (cacheFilePath.empty())
+	{
+		return;
+	}
+
+	//Several generators might start concurrently, so write to a uniquely named file before replacing the cache file
+	fs::path tmpPath = FilesystemHelpers::makeTemporaryPath(cacheFilePath);
+
+	{
+		std::ofstream tmpFile(tmpPath, std::ios::out | std::ios::trunc);
+
+		if (!tmpFile.is_open())
+		{
+			return;
+		}
+
+		tmpFile << cacheFileHeader << "\n";
+		tmpFile << "stamp " << compilerInfo.stamp << "\n";
+
+		//Failures are not cached, so that a compiler fixed or installed later is checked again
+		if (compilerInfo.isSupported.value_or(false))
+		{
+			tmpFile << "supported 1\n";
+		}
+
+		if (compilerInfo.nativeIncludeDirectories.has_value())
+		{
+			tmpFile << "includeDirs " << compilerInfo.nativeIncludeDirectories->size() << "\n";
+
+			for (fs::path const& includeDir : *compilerInfo.nativeIncludeDirectories)
+			{
+				tmpFile << includeDir.string() << "\n";
+			}
+		}
+	}
+
+	std::error_code errorCode;
+	fs::rename(tmpPath, cacheFilePath, errorCode);
+
+	if (errorCode)
+	{
+		fs::remove(tmpPath, errorCode);
+	}
+}
+
 #if _WIN32
 
 fs::path CompilerHelpers::getvswherePath() noexcept
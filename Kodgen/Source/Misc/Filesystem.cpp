@@ -1,6 +1,16 @@
 #include "Kodgen/Misc/Filesystem.h"
 
 #include <algorithm> //std::replace
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#if _WIN32
+#include <process.h>	//_getpid
+#else
+#include <unistd.h>		//getpid
+#endif
 
 using namespace kodgen;
 
@@ -39,4 +49,22 @@ bool FilesystemHelpers::isChildPath(fs::path const& child, fs::path const& other
 	}
 
 	return false;
+}
+
+fs::path FilesystemHelpers::makeTemporaryPath(fs::path const& path) noexcept
+{
+	//The counter makes paths unique within a thread, the thread id within a process, and the process id between processes
+	static std::atomic<size_t> counter{ 0u };
+
+#if _WIN32
+	int processId = _getpid();
+#else
+	int processId = static_cast<int>(getpid());
+#endif
+
+	fs::path result = path;
+	result += "." + std::to_string(processId) + "_" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "_" +
+			  std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_" + std::to_string(counter++) + ".tmp";
+
+	return result;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "Kodgen/Misc/InternedString.h"
+
+using namespace kodgen;
+
+InternedString::InternedString() noexcept
+{
+	//Default constructed handles are common, so don't lock the table for each of them.
+	//The static handle keeps the empty string referenced until the end of the program.
+	static InternedString const emptyString(std::string_view{});
+
+	_entry = emptyString._entry;
+	_entry->referenceCount.fetch_add(1u, std::memory_order_relaxed);
+}
+
+InternedString::InternedString(std::string_view string) noexcept:
+	_entry{&StringTable::getInstance().intern(string)}
+{
+}
+
+InternedString::InternedString(std::string const& string) noexcept:
+	InternedString(std::string_view(string))
+{
+}
+
+InternedString::InternedString(InternedString const& other) noexcept:
+	_entry{other._entry}
+{
+	_entry->referenceCount.fetch_add(1u, std::memory_order_relaxed);
+}
+
+InternedString::~InternedString() noexcept
+{
+	_entry->referenceCount.fetch_sub(1u, std::memory_order_release);
+}
+
+std::string const& InternedString::str() const noexcept
+{
+	return _entry->string;
+}
+
+bool InternedString::empty() const noexcept
+{
+	return _entry->string.empty();
+}
+
+InternedString::operator std::string const&() const noexcept
+{
+	return _entry->string;
+}
+
+InternedString& InternedString::operator=(InternedString const& other) noexcept
+{
+	//Reference the new entry first, so that self-assignment never releases the last reference
+	other._entry->referenceCount.fetch_add(1u, std::memory_order_relaxed);
+	_entry->referenceCount.fetch_sub(1u, std::memory_order_release);
+
+	_entry = other._entry;
+
+	return *this;
+}
+
+bool InternedString::operator==(InternedString const& other) const noexcept
+{
+	return _entry == other._entry;
+}
+
+bool InternedString::operator!=(InternedString const& other) const noexcept
+{
+	return _entry != other._entry;
+}
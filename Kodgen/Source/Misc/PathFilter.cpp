@@ -0,0 +1,267 @@
+#include "Kodgen/Misc/PathFilter.h"
+
+using namespace kodgen;
+
+void PathFilter::splitPath(std::string_view path, std::vector<std::string_view>& out_components) noexcept
+{
+	size_t componentStart = 0u;
+
+	while (componentStart <= path.size())
+	{
+		size_t componentEnd = path.find('/', componentStart);
+
+		if (componentEnd == std::string_view::npos)
+		{
+			componentEnd = path.size();
+		}
+
+		//Keep the leading empty component standing for the root, skip empty components everywhere else
+		if (componentEnd != componentStart || componentStart == 0u)
+		{
+			out_components.push_back(path.substr(componentStart, componentEnd - componentStart));
+		}
+
+		componentStart = componentEnd + 1u;
+	}
+}
+
+bool PathFilter::isPattern(std::string_view path) noexcept
+{
+	return path.find_first_of("*?") != std::string_view::npos;
+}
+
+bool PathFilter::matchComponent(std::string_view pattern, std::string_view component) noexcept
+{
+	size_t patternIndex		= 0u;
+	size_t componentIndex	= 0u;
+	size_t starIndex		= std::string_view::npos;
+	size_t starMatchIndex	= 0u;
+
+	while (componentIndex < component.size())
+	{
+		if (patternIndex < pattern.size() && (pattern[patternIndex] == '?' || pattern[patternIndex] == component[componentIndex]))
+		{
+			patternIndex++;
+			componentIndex++;
+		}
+		else if (patternIndex < pattern.size() && pattern[patternIndex] == '*')
+		{
+			//Try to match the star with an empty string first, and extend it on mismatch
+			starIndex		= patternIndex++;
+			starMatchIndex	= componentIndex;
+		}
+		else if (starIndex != std::string_view::npos)
+		{
+			patternIndex	= starIndex + 1u;
+			componentIndex	= ++starMatchIndex;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	//Remaining pattern characters can only be stars matching empty strings
+	while (patternIndex < pattern.size() && pattern[patternIndex] == '*')
+	{
+		patternIndex++;
+	}
+
+	return patternIndex == pattern.size();
+}
+
+bool PathFilter::matchPattern(std::vector<std::string> const& pattern, size_t patternIndex, std::vector<std::string_view> const& components, size_t componentIndex, size_t componentCount) noexcept
+{
+	for (; patternIndex < pattern.size(); patternIndex++, componentIndex++)
+	{
+		if (pattern[patternIndex] == "**")
+		{
+			//** matches any number of components, including none
+			for (size_t i = componentIndex; i <= componentCount; i++)
+			{
+				if (matchPattern(pattern, patternIndex + 1u, components, i, componentCount))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		if (componentIndex == componentCount || !matchComponent(pattern[patternIndex], components[componentIndex]))
+		{
+			return false;
+		}
+	}
+
+	return componentIndex == componentCount;
+}
+
+void PathFilter::add(fs::path const& path, bool isDirectory) noexcept
+{
+	std::string						pathString = path.generic_string();
+	std::vector<std::string_view>	components;
+
+	if (isPattern(pathString))
+	{
+		//Remove . and .. components so that they don't have to be matched literally
+		pathString = path.lexically_normal().generic_string();
+
+		splitPath(pathString, components);
+
+		//Relative patterns can match anywhere
+		if (path.is_relative() && (components.empty() || components.front() != "**"))
+		{
+			components.insert(components.cbegin(), "**");
+		}
+
+		(isDirectory ? _directoryPatterns : _filePatterns).emplace_back(components.cbegin(), components.cend());
+	}
+	else
+	{
+		std::error_code error;
+
+		pathString = fs::absolute(path, error).lexically_normal().generic_string();
+
+		splitPath(pathString, components);
+
+		uint32 nodeIndex = 0u;
+
+		for (std::string_view component : components)
+		{
+			auto it = _nodes[nodeIndex].children.find(component);
+
+			if (it != _nodes[nodeIndex].children.cend())
+			{
+				nodeIndex = it->second;
+			}
+			else
+			{
+				uint32 childIndex = static_cast<uint32>(_nodes.size());
+
+				_nodes[nodeIndex].children.emplace(std::string(component), childIndex);
+				_nodes.emplace_back();
+
+				nodeIndex = childIndex;
+			}
+		}
+
+		if (isDirectory)
+		{
+			_nodes[nodeIndex].isIgnoredDirectory = true;
+		}
+		else
+		{
+			_nodes[nodeIndex].isIgnoredFile = true;
+		}
+	}
+}
+
+void PathFilter::addIgnoredDirectory(fs::path const& directory) noexcept
+{
+	add(directory, true);
+}
+
+void PathFilter::addIgnoredFile(fs::path const& file) noexcept
+{
+	add(file, false);
+}
+
+void PathFilter::clear() noexcept
+{
+	_nodes = std::vector<TrieNode>(1u);
+	_directoryPatterns.clear();
+	_filePatterns.clear();
+}
+
+bool PathFilter::isIgnoredDirectory(fs::path const& directory) const noexcept
+{
+	std::string						pathString = directory.generic_string();
+	std::vector<std::string_view>	components;
+
+	splitPath(pathString, components);
+
+	//Check the directory and all its parents in the trie
+	uint32 nodeIndex = 0u;
+
+	for (std::string_view component : components)
+	{
+		auto it = _nodes[nodeIndex].children.find(component);
+
+		if (it == _nodes[nodeIndex].children.cend())
+		{
+			break;
+		}
+
+		nodeIndex = it->second;
+
+		if (_nodes[nodeIndex].isIgnoredDirectory)
+		{
+			return true;
+		}
+	}
+
+	//Check the directory and all its parents against the patterns
+	for (std::vector<std::string> const& pattern : _directoryPatterns)
+	{
+		for (size_t componentCount = 1u; componentCount <= components.size(); componentCount++)
+		{
+			if (matchPattern(pattern, 0u, components, 0u, componentCount))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool PathFilter::isIgnoredFile(fs::path const& file) const noexcept
+{
+	std::string						pathString = file.generic_string();
+	std::vector<std::string_view>	components;
+
+	splitPath(pathString, components);
+
+	//Check the file and all its parents in the trie
+	uint32 nodeIndex = 0u;
+
+	for (size_t i = 0u; i < components.size(); i++)
+	{
+		auto it = _nodes[nodeIndex].children.find(components[i]);
+
+		if (it == _nodes[nodeIndex].children.cend())
+		{
+			break;
+		}
+
+		nodeIndex = it->second;
+
+		if ((i + 1u < components.size()) ? _nodes[nodeIndex].isIgnoredDirectory : _nodes[nodeIndex].isIgnoredFile)
+		{
+			return true;
+		}
+	}
+
+	for (std::vector<std::string> const& pattern : _filePatterns)
+	{
+		if (matchPattern(pattern, 0u, components, 0u, components.size()))
+		{
+			return true;
+		}
+	}
+
+	//Check the parents of the file against the directory patterns
+	for (std::vector<std::string> const& pattern : _directoryPatterns)
+	{
+		for (size_t componentCount = 1u; componentCount < components.size(); componentCount++)
+		{
+			if (matchPattern(pattern, 0u, components, 0u, componentCount))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
\ No newline at end of file
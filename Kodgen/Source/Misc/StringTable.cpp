@@ -0,0 +1,76 @@
+#include "Kodgen/Misc/StringTable.h"
+
+#include <functional>	//std::hash
+
+using namespace kodgen;
+
+StringTable& StringTable::getInstance() noexcept
+{
+	static StringTable instance;
+
+	return instance;
+}
+
+StringTable::Entry& StringTable::intern(std::string_view string) noexcept
+{
+	Shard&						shard = _shards[std::hash<std::string_view>()(string) % _shardCount];
+	std::lock_guard<std::mutex>	lock(shard.mutex);
+
+	auto it = shard.entries.find(string);
+
+	if (it == shard.entries.cend())
+	{
+		std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+		entry->string = string;
+
+		//The key must view the interned string, not the provided one
+		std::string_view key = entry->string;
+
+		it = shard.entries.emplace(key, std::move(entry)).first;
+	}
+
+	//The reference is added while the shard is locked, so that the entry can't be removed in the meantime
+	it->second->referenceCount.fetch_add(1u, std::memory_order_relaxed);
+
+	return *it->second;
+}
+
+size_t StringTable::removeUnreferencedStrings() noexcept
+{
+	size_t result = 0u;
+
+	for (Shard& shard : _shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+
+		//References can be released concurrently, but never added to an unreferenced entry without locking the shard
+		for (auto it = shard.entries.begin(); it != shard.entries.end();)
+		{
+			if (it->second->referenceCount.load(std::memory_order_acquire) == 0u)
+			{
+				it = shard.entries.erase(it);
+				result++;
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	return result;
+}
+
+size_t StringTable::getSize() noexcept
+{
+	size_t result = 0u;
+
+	for (Shard& shard : _shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+
+		result += shard.entries.size();
+	}
+
+	return result;
+}
@@ -4,6 +4,11 @@
 #include <array>
 #include <memory>	//std::unique_ptr
 #include <cstdio>	//std::fgets
+#include <cstdlib>	//std::getenv
+
+#if !_WIN32
+#include <unistd.h>	//access
+#endif
 
 using namespace kodgen;
 
@@ -31,4 +36,126 @@ std::string System::executeCommand(std::string const& cmd)
 	}
 
 	return result;
+}
+
+fs::path System::findExecutable(std::string const& exeName) noexcept
+{
+#if _WIN32
+	constexpr char const	pathSeparator		= ';';
+	std::string const		extensions[]		= { "", ".exe" };
+#else
+	constexpr char const	pathSeparator		= ':';
+	std::string const		extensions[]		= { "" };
+#endif
+
+	std::error_code errorCode;
+
+	auto tryCandidate = [&extensions, &errorCode](fs::path const& candidate) -> fs::path
+	{
+		for (std::string const& extension : extensions)
+		{
+			fs::path candidateWithExtension = candidate;
+			candidateWithExtension += extension;
+
+#if _WIN32
+			if (fs::is_regular_file(candidateWithExtension, errorCode))
+#else
+			//Like the shell, skip files the current user can't execute
+			if (fs::is_regular_file(candidateWithExtension, errorCode) && access(candidateWithExtension.c_str(), X_OK) == 0)
+#endif
+			{
+				//Resolve symlinks (/usr/bin/clang -> clang-12) so that the path identifies the actual compiler
+				fs::path canonicalPath = fs::canonical(candidateWithExtension, errorCode);
+
+				return errorCode ? candidateWithExtension : canonicalPath;
+			}
+		}
+
+		return fs::path();
+	};
+
+	if (exeName.empty())
+	{
+		return fs::path();
+	}
+
+	//Paths with a directory part are not looked up in PATH
+	if (fs::path(exeName).has_parent_path())
+	{
+		return tryCandidate(exeName);
+	}
+
+	char const* pathEnv = std::getenv("PATH");
+
+	if (pathEnv == nullptr)
+	{
+		return fs::path();
+	}
+
+	std::string	paths	= pathEnv;
+	size_t		start	= 0u;
+
+	while (start <= paths.size())
+	{
+		size_t end = paths.find(pathSeparator, start);
+
+		if (end == std::string::npos)
+		{
+			end = paths.size();
+		}
+
+		if (end > start)
+		{
+			fs::path result = tryCandidate(fs::path(paths.substr(start, end - start)) / exeName);
+
+			if (!result.empty())
+			{
+				return result;
+			}
+		}
+
+		start = end + 1u;
+	}
+
+	return fs::path();
+}
+
+fs::path System::getUserCacheDirectory() noexcept
+{
+	fs::path cacheDirectory;
+
+#if _WIN32
+	if (char const* localAppData = std::getenv("LOCALAPPDATA"))
+	{
+		cacheDirectory = localAppData;
+	}
+#else
+	char const* xdgCacheHome = std::getenv("XDG_CACHE_HOME");
+
+	//Relative XDG paths are invalid and must be ignored
+	if (xdgCacheHome != nullptr && fs::path(xdgCacheHome).is_absolute())
+	{
+		cacheDirectory = xdgCacheHome;
+	}
+	else if (char const* home = std::getenv("HOME"))
+	{
+		cacheDirectory = fs::path(home) / ".cache";
+	}
+#endif
+
+	if (cacheDirectory.empty())
+	{
+		return fs::path();
+	}
+
+	cacheDirectory /= "Kodgen";
+
+	std::error_code errorCode;
+
+	if (fs::create_directories(cacheDirectory, errorCode))
+	{
+		fs::permissions(cacheDirectory, fs::perms::owner_all, fs::perm_options::replace, errorCode);
+	}
+
+	return fs::is_directory(cacheDirectory, errorCode) ? cacheDirectory : fs::path();
 }
\ No newline at end of file
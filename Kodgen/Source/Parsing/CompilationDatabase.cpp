@@ -0,0 +1,258 @@
+#include "Kodgen/Parsing/CompilationDatabase.h"
+
+#include <algorithm>	//std::sort
+#include <string_view>
+
+#include <clang-c/CXCompilationDatabase.h>
+
+#include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/Helpers.h"
+
+using namespace kodgen;
+
+bool CompilationDatabase::load(fs::path const& compilationDatabasePath, ILogger* logger) noexcept
+{
+	clear();
+
+	fs::path						databaseDirectory	= fs::is_directory(compilationDatabasePath) ? compilationDatabasePath : compilationDatabasePath.parent_path();
+	CXCompilationDatabase_Error		errorCode			= CXCompilationDatabase_NoError;
+	CXCompilationDatabase			database			= clang_CompilationDatabase_fromDirectory(databaseDirectory.string().c_str(), &errorCode);
+
+	if (errorCode != CXCompilationDatabase_NoError || database == nullptr)
+	{
+		if (logger != nullptr)
+		{
+			logger->log("Could not load the compilation database located in " + databaseDirectory.string(), ILogger::ELogSeverity::Error);
+		}
+
+		return false;
+	}
+
+	CXCompileCommands			compileCommands		= clang_CompilationDatabase_getAllCompileCommands(database);
+	unsigned int				compileCommandCount	= clang_CompileCommands_getSize(compileCommands);
+	std::vector<std::string>	commandArguments;
+
+	for (unsigned int i = 0u; i < compileCommandCount; i++)
+	{
+		CXCompileCommand	compileCommand		= clang_CompileCommands_getCommand(compileCommands, i);
+		fs::path			workingDirectory	= Helpers::getString(clang_CompileCommand_getDirectory(compileCommand));
+		fs::path			sourceFile			= FilesystemHelpers::sanitizePath(workingDirectory / Helpers::getString(clang_CompileCommand_getFilename(compileCommand)));
+		unsigned int		argumentCount		= clang_CompileCommand_getNumArgs(compileCommand);
+
+		//Skip commands of files which don't exist anymore
+		if (sourceFile.empty())
+		{
+			continue;
+		}
+
+		commandArguments.clear();
+		commandArguments.reserve(argumentCount);
+
+		//First argument is the compiler itself
+		for (unsigned int j = 1u; j < argumentCount; j++)
+		{
+			commandArguments.emplace_back(Helpers::getString(clang_CompileCommand_getArg(compileCommand, j)));
+		}
+
+		//A file compiled several times keeps its first command
+		if (_sourceFileArgumentSets.emplace(sourceFile, addArgumentSet(filterArguments(commandArguments, workingDirectory))).second)
+		{
+			_directorySourceFiles[sourceFile.parent_path()].emplace_back(sourceFile);
+		}
+	}
+
+	clang_CompileCommands_dispose(compileCommands);
+	clang_CompilationDatabase_dispose(database);
+
+	//Sort source files so that the owner of a header doesn't depend on the database order
+	for (auto& [directory, sourceFiles] : _directorySourceFiles)
+	{
+		std::sort(sourceFiles.begin(), sourceFiles.end());
+	}
+
+	if (logger != nullptr)
+	{
+		logger->log("Loaded " + std::to_string(_sourceFileArgumentSets.size()) + " compile commands (" + std::to_string(_argumentSets.size()) + " distinct argument sets) from " + databaseDirectory.string());
+	}
+
+	return true;
+}
+
+std::vector<std::string> CompilationDatabase::filterArguments(std::vector<std::string> const& commandArguments, fs::path const& workingDirectory) noexcept
+{
+	//Flags followed by a path, which can be either joined (-Ipath) or separated (-I path)
+	//Flags followed by a macro, which can be either joined (-DMACRO) or separated (-D MACRO)
+#if _WIN32
+	//MSVC style flags are only checked on windows, since unix absolute paths might start with /I, /D or /U
+	static constexpr char const* pathFlags[]	= { "-isystem", "-iquote", "-idirafter", "-include", "-imacros", "-I", "/I" };
+	static constexpr char const* macroFlags[]	= { "-D", "-U", "/D", "/U" };
+#else
+	static constexpr char const* pathFlags[]	= { "-isystem", "-iquote", "-idirafter", "-include", "-imacros", "-I" };
+	static constexpr char const* macroFlags[]	= { "-D", "-U" };
+#endif
+
+	std::vector<std::string> result;
+
+	auto makeAbsolute = [&workingDirectory](std::string const& path) -> std::string
+	{
+		fs::path asPath(path);
+
+		return (asPath.is_absolute() ? asPath : (workingDirectory / asPath).lexically_normal()).string();
+	};
+
+	//Get the index of the value of a separated flag, skipping the -Xclang forwarding it to the frontend (-Xclang -include -Xclang path)
+	auto getSeparatedValueIndex = [&commandArguments](size_t flagIndex) -> size_t
+	{
+		return (flagIndex + 1u < commandArguments.size() && commandArguments[flagIndex + 1u] == "-Xclang") ? flagIndex + 2u : flagIndex + 1u;
+	};
+
+	//Append a flag and its value to the result, value being either joined to the flag or the next argument
+	auto tryAppendFlag = [&commandArguments, &result, &getSeparatedValueIndex](size_t& index, std::string_view flag, auto&& transformValue) -> bool
+	{
+		std::string const& argument = commandArguments[index];
+
+		if (argument.compare(0u, flag.size(), flag) != 0)
+		{
+			return false;
+		}
+
+		//Joined values never start with a dash, so the argument is another flag sharing the same prefix (-include-pch is not -include)
+		if (argument.size() > flag.size() && argument[flag.size()] == '-')
+		{
+			return false;
+		}
+
+		//libclang doesn't understand MSVC style flags
+		std::string clangFlag = (flag[0] == '/') ? "-" + std::string(flag.substr(1u)) : std::string(flag);
+
+		if (argument.size() > flag.size())
+		{
+			result.emplace_back(clangFlag + transformValue(argument.substr(flag.size())));
+		}
+		else if (size_t valueIndex = getSeparatedValueIndex(index); valueIndex < commandArguments.size())
+		{
+			result.emplace_back(clangFlag + transformValue(commandArguments[valueIndex]));
+
+			index = valueIndex;
+		}
+
+		return true;
+	};
+
+	auto keepValue = [](std::string const& value) -> std::string const&
+	{
+		return value;
+	};
+
+	for (size_t i = 0u; i < commandArguments.size(); i++)
+	{
+		//The target PCH (-Xclang -include-pch -Xclang path with CMake) is built with the compiler version of the project,
+		//which libclang can't read, so drop it with its value. The prefix header itself is still included with -include
+		if (commandArguments[i] == "-include-pch")
+		{
+			i = getSeparatedValueIndex(i);
+
+			continue;
+		}
+
+		bool isPathFlag = false;
+
+		for (std::string_view flag : pathFlags)
+		{
+			if (tryAppendFlag(i, flag, makeAbsolute))
+			{
+				isPathFlag = true;
+				break;
+			}
+		}
+
+		if (!isPathFlag)
+		{
+			for (std::string_view flag : macroFlags)
+			{
+				if (tryAppendFlag(i, flag, keepValue))
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+size_t CompilationDatabase::addArgumentSet(std::vector<std::string>&& arguments) noexcept
+{
+	std::string key;
+
+	//Arguments never contain null characters, so joining them with it keeps argument boundaries in the key
+	for (std::string const& argument : arguments)
+	{
+		key += argument;
+		key += '\0';
+	}
+
+	auto [it, isNewArgumentSet] = _argumentSetIndices.try_emplace(std::move(key), _argumentSets.size());
+
+	if (isNewArgumentSet)
+	{
+		_argumentSets.emplace_back(std::forward<std::vector<std::string>>(arguments));
+	}
+
+	return it->second;
+}
+
+void CompilationDatabase::clear() noexcept
+{
+	_argumentSets.clear();
+	_argumentSetIndices.clear();
+	_sourceFileArgumentSets.clear();
+	_directorySourceFiles.clear();
+}
+
+size_t CompilationDatabase::findArgumentSetIndex(fs::path const& file) const noexcept
+{
+	//Source file of the database
+	auto sourceFileIt = _sourceFileArgumentSets.find(file);
+
+	if (sourceFileIt != _sourceFileArgumentSets.cend())
+	{
+		return sourceFileIt->second;
+	}
+
+	//Header: look for a source file in the closest directory
+	for (fs::path directory = file.parent_path(); !directory.empty(); directory = directory.parent_path())
+	{
+		auto directoryIt = _directorySourceFiles.find(directory);
+
+		if (directoryIt != _directorySourceFiles.cend())
+		{
+			fs::path const* owner = &directoryIt->second.front();
+
+			//Prefer the source file implementing the header (Foo.h -> Foo.cpp)
+			for (fs::path const& sourceFile : directoryIt->second)
+			{
+				if (sourceFile.stem() == file.stem())
+				{
+					owner = &sourceFile;
+					break;
+				}
+			}
+
+			return _sourceFileArgumentSets.find(*owner)->second;
+		}
+
+		//Reached the root
+		if (directory == directory.parent_path())
+		{
+			break;
+		}
+	}
+
+	return _argumentSets.size();
+}
+
+std::vector<std::vector<std::string>> const& CompilationDatabase::getArgumentSets() const noexcept
+{
+	return _argumentSets;
+}
\ No newline at end of file
@@ -11,7 +11,8 @@ using namespace kodgen;
 FileParser::FileParser() noexcept:
 	_clangIndex{clang_createIndex(0, 0)},
 	_settings{std::make_shared<ParsingSettings>()},
-	logger{nullptr}
+	logger{nullptr},
+	translationUnitCache{nullptr}
 {
 }
 
@@ -19,7 +20,8 @@ FileParser::FileParser(FileParser const& other) noexcept:
 	NamespaceParser(other),
 	_clangIndex{clang_createIndex(0, 0)},	//Don't copy clang index, create a new one
 	_settings{other._settings},
-	logger{other.logger}
+	logger{other.logger},
+	translationUnitCache{other.translationUnitCache}
 {
 }
 
@@ -28,7 +30,8 @@ FileParser::FileParser(FileParser&& other) noexcept:
 	_clangIndex{std::forward<CXIndex>(other._clangIndex)},
 	_propertyParser(std::forward<PropertyParser>(other._propertyParser)),
 	_settings{other._settings},
-	logger{other.logger}
+	logger{other.logger},
+	translationUnitCache{other.translationUnitCache}
 {
 	other._clangIndex = nullptr;
 }
@@ -55,7 +58,11 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 		out_result.parsedFile = FilesystemHelpers::sanitizePath(toParseFile);
 
 		//Parse the given file
-		CXTranslationUnit translationUnit = clang_parseTranslationUnit(_clangIndex, toParseFile.string().c_str(), _settings->getCompilationArguments().data(), static_cast<int32>(_settings->getCompilationArguments().size()), nullptr, 0, CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing);
+		std::vector<char const*> const&	compilationArguments	= _settings->getCompilationArguments(out_result.parsedFile);
+		unsigned int					parsingOptions			= CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing;
+		CXTranslationUnit				translationUnit			= (translationUnitCache != nullptr) ?
+												translationUnitCache->getTranslationUnit(toParseFile, compilationArguments, parsingOptions) :
+												clang_parseTranslationUnit(_clangIndex, toParseFile.string().c_str(), compilationArguments.data(), static_cast<int32>(compilationArguments.size()), nullptr, 0, parsingOptions);
 
 		if (translationUnit != nullptr)
 		{
@@ -70,6 +77,12 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 				//Refresh all outer entities contained in the final result
 				refreshOuterEntity(out_result);
 
+				//Compact the inheritance hierarchy now that all links are known
+				out_result.structClassTree.build();
+
+				//Collect the files included by the parsed file
+				clang_getInclusions(translationUnit, &FileParser::collectIncludedFile, this);
+
 				isSuccess = true;
 			}
 
@@ -83,7 +96,11 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 				logDiagnostic(translationUnit);
 			}
 
-			clang_disposeTranslationUnit(translationUnit);
+			//Cached translation units are owned by the cache
+			if (translationUnitCache == nullptr)
+			{
+				clang_disposeTranslationUnit(translationUnit);
+			}
 		}
 		else
 		{
@@ -150,6 +167,25 @@ CXChildVisitResult FileParser::parseNestedEntity(CXCursor cursor, CXCursor /* pa
 	return visitResult;
 }
 
+void FileParser::collectIncludedFile(CXFile includedFile, CXSourceLocation* /* inclusionStack */, unsigned int inclusionDepth, CXClientData clientData) noexcept
+{
+	FileParser* parser = reinterpret_cast<FileParser*>(clientData);
+
+	//Skip the main file itself
+	if (inclusionDepth == 0u)
+	{
+		return;
+	}
+
+	//System headers only change with the compiler, don't track them
+	CXTranslationUnit translationUnit = clang_Cursor_getTranslationUnit(parser->getContext().rootCursor);
+
+	if (!clang_Location_isInSystemHeader(clang_getLocationForOffset(translationUnit, includedFile, 0u)))
+	{
+		parser->getParsingResult()->includedFiles.emplace_back(Helpers::getString(clang_getFileName(includedFile)));
+	}
+}
+
 ParsingContext& FileParser::pushContext(CXTranslationUnit const& translationUnit, FileParsingResult& out_result) noexcept
 {
 	_propertyParser.setup(_settings->propertyParsingSettings);
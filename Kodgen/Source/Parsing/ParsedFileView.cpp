@@ -0,0 +1,272 @@
+#include "Kodgen/Parsing/ParsedFileView.h"
+
+#include <cstring>	//std::memcmp
+#include <cstdint>	//std::uintptr_t
+
+using namespace kodgen;
+
+ParsedFileView::ParsedFileView(std::string_view data) noexcept
+{
+	using ESection = ParsedFileFormat::ESection;
+
+	//Records are read in place, so the data must be aligned as the sections are
+	if (reinterpret_cast<std::uintptr_t>(data.data()) % ParsedFileFormat::sectionAlignment != 0u ||
+		data.size() < sizeof(ParsedFileFormat::Header))
+	{
+		return;
+	}
+
+	_header = reinterpret_cast<ParsedFileFormat::Header const*>(data.data());
+
+	ArrayView<char> stringData;
+
+	if (std::memcmp(_header->magic, ParsedFileFormat::magic, sizeof(ParsedFileFormat::magic)) != 0 ||
+		_header->version != ParsedFileFormat::version ||
+		!initSection(data, ESection::StringOffsets, _stringOffsets) ||
+		!initSection(data, ESection::StringData, stringData) ||
+		!initSection(data, ESection::Entities, _entities) ||
+		!initSection(data, ESection::Types, _types) ||
+		!initSection(data, ESection::TemplateParams, _templateParams) ||
+		!initSection(data, ESection::TypeParts, _typeParts) ||
+		!initSection(data, ESection::Properties, _properties) ||
+		!initSection(data, ESection::PropertyArguments, _propertyArguments) ||
+		!initSection(data, ESection::TypedArguments, _typedArguments) ||
+		!initSection(data, ESection::Parents, _parents) ||
+		!initSection(data, ESection::FunctionParams, _functionParams) ||
+		!initSection(data, ESection::IncludedFiles, _includedFiles) ||
+		!initSection(data, ESection::StructClassTreeNodes, _structClassTreeNodes) ||
+		!initSection(data, ESection::StructClassTreeLinks, _structClassTreeLinks))
+	{
+		_header = nullptr;
+
+		return;
+	}
+
+	_stringData = stringData.begin();
+
+	if (!validate(stringData.size()))
+	{
+		_header = nullptr;
+	}
+}
+
+bool ParsedFileView::validate(uint64 stringDataSize) const noexcept
+{
+	constexpr uint32 invalidIndex = ParsedFileFormat::invalidIndex;
+
+	if (_stringOffsets.empty() || _stringOffsets[0] != 0u || _stringOffsets[_stringOffsets.size() - 1u] != stringDataSize)
+	{
+		return false;
+	}
+
+	for (uint32 i = 1u; i < _stringOffsets.size(); i++)
+	{
+		if (_stringOffsets[i] < _stringOffsets[i - 1u])
+		{
+			return false;
+		}
+	}
+
+	uint32 const stringCount = _stringOffsets.size() - 1u;
+
+	auto isString			= [stringCount](uint32 index)					{ return index < stringCount; };
+	auto isOptionalString	= [stringCount](uint32 index)					{ return index == invalidIndex || index < stringCount; };
+	auto isOptionalType		= [this](uint32 index)							{ return index == invalidIndex || index < _types.size(); };
+	auto isRange			= [](uint32 first, uint32 count, uint32 size)	{ return count == 0u || (first <= size && count <= size - first); };
+
+	if (!isString(_header->parsedFile))
+	{
+		return false;
+	}
+
+	for (uint32 i = 0u; i < _entities.size(); i++)
+	{
+		ParsedFileFormat::EntityRecord const& entity = _entities[i];
+
+		//Nested entities must be stored inside the subtree of their outer entity so that traversals always move forward
+		if (!isString(entity.name) || !isString(entity.id) ||
+			entity.subtreeEnd <= i || entity.subtreeEnd > _entities.size() ||
+			(entity.outerEntity != invalidIndex && (entity.outerEntity >= i || _entities[entity.outerEntity].subtreeEnd < entity.subtreeEnd)) ||
+			!isRange(entity.firstProperty, entity.propertyCount, _properties.size()) ||
+			!isOptionalType(entity.type) || !isOptionalType(entity.underlyingType) || !isOptionalString(entity.prototype) ||
+			!isRange(entity.firstParent, entity.parentCount, _parents.size()) ||
+			!isRange(entity.firstParameter, entity.parameterCount, _functionParams.size()))
+		{
+			return false;
+		}
+	}
+
+	for (uint32 i = 0u; i < _types.size(); i++)
+	{
+		ParsedFileFormat::TypeRecord const& type = _types[i];
+
+		if (!isString(type.fullName) || !isString(type.canonicalFullName) ||
+			!isRange(type.firstTemplateParam, type.templateParamCount, _templateParams.size()) ||
+			!isRange(type.firstTypePart, type.typePartCount, _typeParts.size()))
+		{
+			return false;
+		}
+
+		//Template parameter types must come after their owner, so that type recursion is bounded
+		for (uint32 j = type.firstTemplateParam; j < type.firstTemplateParam + type.templateParamCount; j++)
+		{
+			if (!isString(_templateParams[j].name) ||
+				(_templateParams[j].type != invalidIndex && (_templateParams[j].type <= i || _templateParams[j].type >= _types.size())))
+			{
+				return false;
+			}
+		}
+	}
+
+	for (ParsedFileFormat::PropertyRecord const& property : _properties)
+	{
+		if (!isString(property.name) ||
+			!isRange(property.firstArgument, property.argumentCount, _propertyArguments.size()) ||
+			!isRange(property.firstTypedArgument, property.typedArgumentCount, _typedArguments.size()))
+		{
+			return false;
+		}
+	}
+
+	for (uint32 argument : _propertyArguments)
+	{
+		if (!isString(argument))
+		{
+			return false;
+		}
+	}
+
+	for (uint32 i = 0u; i < _typedArguments.size(); i++)
+	{
+		ParsedFileFormat::TypedArgumentRecord const& argument = _typedArguments[i];
+
+		if (!isOptionalString(argument.stringValue) ||
+			!isRange(argument.firstListElement, argument.listElementCount, _typedArguments.size()) ||
+			(argument.listElementCount != 0u && argument.firstListElement <= i))
+		{
+			return false;
+		}
+	}
+
+	for (ParsedFileFormat::ParentRecord const& parent : _parents)
+	{
+		if (parent.type >= _types.size())
+		{
+			return false;
+		}
+	}
+
+	for (ParsedFileFormat::FunctionParamRecord const& parameter : _functionParams)
+	{
+		if (parameter.type >= _types.size() || !isString(parameter.name))
+		{
+			return false;
+		}
+	}
+
+	for (uint32 includedFile : _includedFiles)
+	{
+		if (!isString(includedFile))
+		{
+			return false;
+		}
+	}
+
+	for (uint32 node : _structClassTreeNodes)
+	{
+		if (!isString(node))
+		{
+			return false;
+		}
+	}
+
+	for (ParsedFileFormat::StructClassTreeLinkRecord const& link : _structClassTreeLinks)
+	{
+		if (link.child >= _structClassTreeNodes.size() || link.parent >= _structClassTreeNodes.size())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ParsedFileView::isValid() const noexcept
+{
+	return _header != nullptr;
+}
+
+std::string_view ParsedFileView::getString(uint32 index) const noexcept
+{
+	if (index == ParsedFileFormat::invalidIndex)
+	{
+		return std::string_view();
+	}
+
+	return std::string_view(_stringData + _stringOffsets[index], _stringOffsets[index + 1u] - _stringOffsets[index]);
+}
+
+std::string_view ParsedFileView::getParsedFile() const noexcept
+{
+	return getString(_header->parsedFile);
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::EntityRecord> const& ParsedFileView::getEntities() const noexcept
+{
+	return _entities;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::TypeRecord> const& ParsedFileView::getTypes() const noexcept
+{
+	return _types;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::TemplateParamRecord> const& ParsedFileView::getTemplateParams() const noexcept
+{
+	return _templateParams;
+}
+
+ParsedFileView::ArrayView<TypePart> const& ParsedFileView::getTypeParts() const noexcept
+{
+	return _typeParts;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::PropertyRecord> const& ParsedFileView::getProperties() const noexcept
+{
+	return _properties;
+}
+
+ParsedFileView::ArrayView<uint32> const& ParsedFileView::getPropertyArguments() const noexcept
+{
+	return _propertyArguments;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::TypedArgumentRecord> const& ParsedFileView::getTypedArguments() const noexcept
+{
+	return _typedArguments;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::ParentRecord> const& ParsedFileView::getParents() const noexcept
+{
+	return _parents;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::FunctionParamRecord> const& ParsedFileView::getFunctionParams() const noexcept
+{
+	return _functionParams;
+}
+
+ParsedFileView::ArrayView<uint32> const& ParsedFileView::getIncludedFiles() const noexcept
+{
+	return _includedFiles;
+}
+
+ParsedFileView::ArrayView<uint32> const& ParsedFileView::getStructClassTreeNodes() const noexcept
+{
+	return _structClassTreeNodes;
+}
+
+ParsedFileView::ArrayView<ParsedFileFormat::StructClassTreeLinkRecord> const& ParsedFileView::getStructClassTreeLinks() const noexcept
+{
+	return _structClassTreeLinks;
+}
@@ -0,0 +1,351 @@
+#include "Kodgen/Parsing/ParsingResultReader.h"
+
+#include <cstring>	//std::memcpy
+#include <cstdint>	//std::uintptr_t
+
+using namespace kodgen;
+
+using EEntityFlags = ParsedFileFormat::EEntityFlags;
+
+ParsingResultReader::ParsingResultReader(std::string_view data) noexcept
+{
+	//Records are read in place, so misaligned data must be copied to an aligned buffer first
+	if (reinterpret_cast<std::uintptr_t>(data.data()) % ParsedFileFormat::sectionAlignment != 0u)
+	{
+		_alignedData.resize((data.size() + sizeof(uint64) - 1u) / sizeof(uint64));
+		std::memcpy(_alignedData.data(), data.data(), data.size());
+
+		data = std::string_view(reinterpret_cast<char const*>(_alignedData.data()), data.size());
+	}
+
+	_view = ParsedFileView(data);
+}
+
+void ParsingResultReader::readProperty(ParsedFileFormat::PropertyRecord const& record, Property& out_property) noexcept
+{
+	out_property.name = _view.getString(record.name);
+
+	out_property.arguments.reserve(record.argumentCount);
+
+	for (uint32 i = record.firstArgument; i < record.firstArgument + record.argumentCount; i++)
+	{
+		out_property.arguments.emplace_back(_view.getString(_view.getPropertyArguments()[i]));
+	}
+
+	out_property.typedArguments.resize(record.typedArgumentCount);
+
+	for (uint32 i = 0u; i < record.typedArgumentCount; i++)
+	{
+		readTypedArgument(record.firstTypedArgument + i, out_property.typedArguments[i]);
+	}
+}
+
+void ParsingResultReader::readTypedArgument(uint32 argumentIndex, PropertyArgument& out_argument) noexcept
+{
+	ParsedFileFormat::TypedArgumentRecord const& record = _view.getTypedArguments()[argumentIndex];
+
+	out_argument.type				= record.type;
+	out_argument.stringValue		= _view.getString(record.stringValue);
+	out_argument.integerValue		= record.integerValue;
+	out_argument.floatingPointValue	= record.floatingPointValue;
+	out_argument.booleanValue		= (record.booleanValue != 0u);
+
+	out_argument.listValue.resize(record.listElementCount);
+
+	for (uint32 i = 0u; i < record.listElementCount; i++)
+	{
+		readTypedArgument(record.firstListElement + i, out_argument.listValue[i]);
+	}
+}
+
+void ParsingResultReader::readType(uint32 typeIndex, TypeInfo& out_type) noexcept
+{
+	if (typeIndex == ParsedFileFormat::invalidIndex)
+	{
+		return;
+	}
+
+	ParsedFileFormat::TypeRecord const& record = _view.getTypes()[typeIndex];
+
+	out_type._fullName			= InternedString(std::string(_view.getString(record.fullName)));
+	out_type._canonicalFullName	= InternedString(std::string(_view.getString(record.canonicalFullName)));
+	out_type.sizeInBytes		= static_cast<size_t>(record.sizeInBytes);
+
+	out_type.typeParts.assign(_view.getTypeParts().begin() + record.firstTypePart,
+							  _view.getTypeParts().begin() + record.firstTypePart + record.typePartCount);
+
+	out_type._templateParameters.resize(record.templateParamCount);
+
+	for (uint32 i = 0u; i < record.templateParamCount; i++)
+	{
+		ParsedFileFormat::TemplateParamRecord const&	templateParamRecord	= _view.getTemplateParams()[record.firstTemplateParam + i];
+		TemplateParamInfo&								templateParam		= out_type._templateParameters[i];
+
+		templateParam.kind	= templateParamRecord.kind;
+		templateParam.name	= _view.getString(templateParamRecord.name);
+
+		if (templateParamRecord.type != ParsedFileFormat::invalidIndex)
+		{
+			templateParam.type = std::make_unique<TypeInfo>();
+
+			readType(templateParamRecord.type, *templateParam.type);
+		}
+	}
+}
+
+void ParsingResultReader::readEntity(uint32 entityIndex, EntityInfo& out_entity) noexcept
+{
+	ParsedFileFormat::EntityRecord const& record = _view.getEntities()[entityIndex];
+
+	out_entity.entityType	= record.entityType;
+	out_entity.name			= _view.getString(record.name);
+	out_entity.id			= _view.getString(record.id);
+
+	out_entity.properties.resize(record.propertyCount);
+
+	for (uint32 i = 0u; i < record.propertyCount; i++)
+	{
+		readProperty(_view.getProperties()[record.firstProperty + i], out_entity.properties[i]);
+	}
+}
+
+void ParsingResultReader::readNamespace(uint32 entityIndex, NamespaceInfo& out_namespace) noexcept
+{
+	readEntity(entityIndex, out_namespace);
+
+	readNamespaceMembers(entityIndex + 1u, _view.getEntities()[entityIndex].subtreeEnd, out_namespace);
+}
+
+void ParsingResultReader::readStructClass(uint32 entityIndex, StructClassInfo& out_structClass) noexcept
+{
+	ParsedFileView::ArrayView<ParsedFileFormat::EntityRecord> const&	entities	= _view.getEntities();
+	ParsedFileFormat::EntityRecord const&								record		= entities[entityIndex];
+
+	readEntity(entityIndex, out_structClass);
+
+	out_structClass.qualifiers.isFinal		= record.hasFlag(EEntityFlags::IsFinal);
+	out_structClass.isForwardDeclaration	= record.hasFlag(EEntityFlags::IsForwardDeclaration);
+	out_structClass.isImportExport			= record.hasFlag(EEntityFlags::IsImportExport);
+
+	readType(record.type, out_structClass.type);
+
+	out_structClass.parents.reserve(record.parentCount);
+
+	for (uint32 i = record.firstParent; i < record.firstParent + record.parentCount; i++)
+	{
+		TypeInfo type;
+
+		readType(_view.getParents()[i].type, type);
+
+		out_structClass.parents.emplace_back(_view.getParents()[i].inheritanceAccess, std::move(type));
+	}
+
+	for (uint32 nestedIndex = entityIndex + 1u; nestedIndex < record.subtreeEnd && _isValid; nestedIndex = entities[nestedIndex].subtreeEnd)
+	{
+		ParsedFileFormat::EntityRecord const& nestedRecord = entities[nestedIndex];
+
+		switch (nestedRecord.entityType)
+		{
+			case EEntityType::Struct:
+				[[fallthrough]];
+			case EEntityType::Class:
+				{
+					StructClassInfo nestedStructClass;
+
+					readStructClass(nestedIndex, nestedStructClass);
+
+					std::vector<std::shared_ptr<NestedStructClassInfo>>& nestedStructClasses = (nestedRecord.entityType == EEntityType::Struct) ?
+																								out_structClass.nestedStructs : out_structClass.nestedClasses;
+
+					nestedStructClasses.push_back(std::make_shared<NestedStructClassInfo>(std::move(nestedStructClass), nestedRecord.accessSpecifier));
+				}
+				break;
+
+			case EEntityType::Enum:
+				{
+					EnumInfo nestedEnum;
+
+					readEnum(nestedIndex, nestedEnum);
+
+					out_structClass.nestedEnums.emplace_back(std::move(nestedEnum), nestedRecord.accessSpecifier);
+				}
+				break;
+
+			case EEntityType::Field:
+				readField(nestedIndex, out_structClass.fields.emplace_back());
+				break;
+
+			case EEntityType::Method:
+				readMethod(nestedIndex, out_structClass.methods.emplace_back());
+				break;
+
+			default:
+				_isValid = false;
+				break;
+		}
+	}
+}
+
+void ParsingResultReader::readEnum(uint32 entityIndex, EnumInfo& out_enum) noexcept
+{
+	ParsedFileView::ArrayView<ParsedFileFormat::EntityRecord> const&	entities	= _view.getEntities();
+	ParsedFileFormat::EntityRecord const&								record		= entities[entityIndex];
+
+	readEntity(entityIndex, out_enum);
+
+	readType(record.type, out_enum.type);
+	readType(record.underlyingType, out_enum.underlyingType);
+
+	for (uint32 valueIndex = entityIndex + 1u; valueIndex < record.subtreeEnd && _isValid; valueIndex = entities[valueIndex].subtreeEnd)
+	{
+		if (entities[valueIndex].entityType != EEntityType::EnumValue)
+		{
+			_isValid = false;
+
+			return;
+		}
+
+		readEnumValue(valueIndex, out_enum.enumValues.emplace_back());
+	}
+}
+
+void ParsingResultReader::readEnumValue(uint32 entityIndex, EnumValueInfo& out_enumValue) noexcept
+{
+	readEntity(entityIndex, out_enumValue);
+
+	out_enumValue.value = _view.getEntities()[entityIndex].value;
+}
+
+void ParsingResultReader::readVariable(uint32 entityIndex, VariableInfo& out_variable) noexcept
+{
+	ParsedFileFormat::EntityRecord const& record = _view.getEntities()[entityIndex];
+
+	readEntity(entityIndex, out_variable);
+
+	out_variable.isStatic = record.hasFlag(EEntityFlags::IsStatic);
+
+	readType(record.type, out_variable.type);
+}
+
+void ParsingResultReader::readField(uint32 entityIndex, FieldInfo& out_field) noexcept
+{
+	ParsedFileFormat::EntityRecord const& record = _view.getEntities()[entityIndex];
+
+	readVariable(entityIndex, out_field);
+
+	out_field.isMutable			= record.hasFlag(EEntityFlags::IsMutable);
+	out_field.accessSpecifier	= record.accessSpecifier;
+	out_field.memoryOffset		= record.value;
+}
+
+void ParsingResultReader::readFunction(uint32 entityIndex, FunctionInfo& out_function) noexcept
+{
+	ParsedFileFormat::EntityRecord const& record = _view.getEntities()[entityIndex];
+
+	readEntity(entityIndex, out_function);
+
+	out_function.prototype	= _view.getString(record.prototype);
+	out_function.isInline	= record.hasFlag(EEntityFlags::IsInline);
+	out_function.isStatic	= record.hasFlag(EEntityFlags::IsStatic);
+
+	readType(record.type, out_function.returnType);
+
+	out_function.parameters.resize(record.parameterCount);
+
+	for (uint32 i = 0u; i < record.parameterCount; i++)
+	{
+		ParsedFileFormat::FunctionParamRecord const& parameterRecord = _view.getFunctionParams()[record.firstParameter + i];
+
+		readType(parameterRecord.type, out_function.parameters[i].type);
+		out_function.parameters[i].name = _view.getString(parameterRecord.name);
+	}
+}
+
+void ParsingResultReader::readMethod(uint32 entityIndex, MethodInfo& out_method) noexcept
+{
+	ParsedFileFormat::EntityRecord const& record = _view.getEntities()[entityIndex];
+
+	readFunction(entityIndex, out_method);
+
+	out_method.accessSpecifier	= record.accessSpecifier;
+	out_method.isDefault		= record.hasFlag(EEntityFlags::IsDefault);
+	out_method.isVirtual		= record.hasFlag(EEntityFlags::IsVirtual);
+	out_method.isPureVirtual	= record.hasFlag(EEntityFlags::IsPureVirtual);
+	out_method.isOverride		= record.hasFlag(EEntityFlags::IsOverride);
+	out_method.isFinal			= record.hasFlag(EEntityFlags::IsFinal);
+	out_method.isConst			= record.hasFlag(EEntityFlags::IsConst);
+}
+
+void ParsingResultReader::readStructClassTree(StructClassTree& out_structClassTree) noexcept
+{
+	ParsedFileView::ArrayView<uint32> const& nodes = _view.getStructClassTreeNodes();
+
+	//Add the nodes first so that they get the same ids as in the written tree
+	for (uint32 node : nodes)
+	{
+		out_structClassTree.getOrAddNode(std::string(_view.getString(node)));
+	}
+
+	for (ParsedFileFormat::StructClassTreeLinkRecord const& link : _view.getStructClassTreeLinks())
+	{
+		out_structClassTree.addInheritanceLink(std::string(_view.getString(nodes[link.child])),
+											   std::string(_view.getString(nodes[link.parent])),
+											   link.inheritanceAccess);
+	}
+
+	out_structClassTree.build();
+}
+
+void ParsingResultReader::refreshOuterEntity(FileParsingResult& out_result) noexcept
+{
+	for (NamespaceInfo& namespaceInfo : out_result.namespaces)
+	{
+		namespaceInfo.refreshOuterEntity();
+	}
+
+	for (StructClassInfo& structInfo : out_result.structs)
+	{
+		structInfo.refreshOuterEntity();
+	}
+
+	for (StructClassInfo& classInfo : out_result.classes)
+	{
+		classInfo.refreshOuterEntity();
+	}
+
+	for (EnumInfo& enumInfo : out_result.enums)
+	{
+		enumInfo.refreshOuterEntity();
+	}
+}
+
+bool ParsingResultReader::read(FileParsingResult& out_result) noexcept
+{
+	if (!_view.isValid())
+	{
+		return false;
+	}
+
+	out_result.parsedFile = _view.getParsedFile();
+
+	readNamespaceMembers(0u, _view.getEntities().size(), out_result);
+
+	if (!_isValid)
+	{
+		return false;
+	}
+
+	out_result.includedFiles.reserve(_view.getIncludedFiles().size());
+
+	for (uint32 includedFile : _view.getIncludedFiles())
+	{
+		out_result.includedFiles.emplace_back(_view.getString(includedFile));
+	}
+
+	readStructClassTree(out_result.structClassTree);
+
+	//Entities are moved while read, so outer entities can only be set once everything is in place
+	refreshOuterEntity(out_result);
+
+	return true;
+}
@@ -0,0 +1,427 @@
+#include "Kodgen/Parsing/ParsingResultWriter.h"
+
+#include <cstring>	//std::memcpy
+
+using namespace kodgen;
+
+using EEntityFlags = ParsedFileFormat::EEntityFlags;
+
+static uint32 toFlag(bool isSet, EEntityFlags flag) noexcept
+{
+	return isSet ? static_cast<uint32>(flag) : 0u;
+}
+
+void ParsingResultWriter::clear() noexcept
+{
+	_data.clear();
+	_stringIndices.clear();
+	_stringOffsets.assign(1u, 0u);
+	_stringData.clear();
+	_entities.clear();
+	_types.clear();
+	_templateParams.clear();
+	_typeParts.clear();
+	_properties.clear();
+	_propertyArguments.clear();
+	_typedArguments.clear();
+	_parents.clear();
+	_functionParams.clear();
+	_includedFiles.clear();
+	_structClassTreeNodes.clear();
+	_structClassTreeLinks.clear();
+}
+
+uint32 ParsingResultWriter::addString(std::string_view string) noexcept
+{
+	auto [it, isInserted] = _stringIndices.try_emplace(std::string(string), static_cast<uint32>(_stringOffsets.size() - 1u));
+
+	if (isInserted)
+	{
+		_stringData.append(string);
+		_stringOffsets.push_back(static_cast<uint32>(_stringData.size()));
+	}
+
+	return it->second;
+}
+
+uint32 ParsingResultWriter::addType(TypeInfo const& type) noexcept
+{
+	uint32								typeIndex = static_cast<uint32>(_types.size());
+	ParsedFileFormat::TypeRecord		record{};
+
+	record.fullName				= addString(type._fullName.str());
+	record.canonicalFullName	= addString(type._canonicalFullName.str());
+	record.firstTypePart		= static_cast<uint32>(_typeParts.size());
+	record.typePartCount		= static_cast<uint32>(type.typeParts.size());
+	record.firstTemplateParam	= static_cast<uint32>(_templateParams.size());
+	record.templateParamCount	= static_cast<uint32>(type._templateParameters.size());
+	record.sizeInBytes			= static_cast<uint64>(type.sizeInBytes);
+
+	_types.push_back(record);
+	_typeParts.insert(_typeParts.end(), type.typeParts.cbegin(), type.typeParts.cend());
+
+	//Reserve the parameter range first: parameter types are added after it, which keeps each type range contiguous
+	_templateParams.resize(_templateParams.size() + type._templateParameters.size());
+
+	for (uint32 i = 0u; i < record.templateParamCount; i++)
+	{
+		TemplateParamInfo const&				templateParam = type._templateParameters[i];
+		ParsedFileFormat::TemplateParamRecord	templateParamRecord{};
+
+		templateParamRecord.name	= addString(templateParam.name);
+		templateParamRecord.kind	= templateParam.kind;
+		templateParamRecord.type	= (templateParam.type != nullptr) ? addType(*templateParam.type) : ParsedFileFormat::invalidIndex;
+
+		_templateParams[record.firstTemplateParam + i] = templateParamRecord;
+	}
+
+	return typeIndex;
+}
+
+uint32 ParsingResultWriter::addTypedArguments(std::vector<PropertyArgument> const& arguments) noexcept
+{
+	uint32 firstArgument = static_cast<uint32>(_typedArguments.size());
+
+	//Reserve the argument range first: list elements are added after it, which keeps each list contiguous
+	_typedArguments.resize(_typedArguments.size() + arguments.size());
+
+	for (uint32 i = 0u; i < arguments.size(); i++)
+	{
+		PropertyArgument const&					argument = arguments[i];
+		ParsedFileFormat::TypedArgumentRecord	record{};
+
+		record.type					= argument.type;
+		record.booleanValue			= argument.booleanValue ? 1u : 0u;
+		record.stringValue			= argument.stringValue.empty() ? ParsedFileFormat::invalidIndex : addString(argument.stringValue);
+		record.integerValue			= argument.integerValue;
+		record.floatingPointValue	= argument.floatingPointValue;
+		record.listElementCount		= static_cast<uint32>(argument.listValue.size());
+		record.firstListElement		= argument.listValue.empty() ? 0u : addTypedArguments(argument.listValue);
+
+		_typedArguments[firstArgument + i] = record;
+	}
+
+	return firstArgument;
+}
+
+uint32 ParsingResultWriter::addEntity(EntityInfo const& entity, uint32 outerEntity, EAccessSpecifier accessSpecifier) noexcept
+{
+	uint32							entityIndex = static_cast<uint32>(_entities.size());
+	ParsedFileFormat::EntityRecord	record{};
+
+	record.entityType		= entity.entityType;
+	record.accessSpecifier	= accessSpecifier;
+	record.name				= addString(entity.name);
+	record.id				= addString(entity.id);
+	record.outerEntity		= outerEntity;
+	record.subtreeEnd		= entityIndex + 1u;
+	record.firstProperty	= static_cast<uint32>(_properties.size());
+	record.propertyCount	= static_cast<uint32>(entity.properties.size());
+	record.type				= ParsedFileFormat::invalidIndex;
+	record.underlyingType	= ParsedFileFormat::invalidIndex;
+	record.prototype		= ParsedFileFormat::invalidIndex;
+
+	for (Property const& property : entity.properties)
+	{
+		ParsedFileFormat::PropertyRecord propertyRecord{};
+
+		propertyRecord.name					= addString(property.name);
+		propertyRecord.firstArgument		= static_cast<uint32>(_propertyArguments.size());
+		propertyRecord.argumentCount		= static_cast<uint32>(property.arguments.size());
+		propertyRecord.typedArgumentCount	= static_cast<uint32>(property.typedArguments.size());
+		propertyRecord.firstTypedArgument	= addTypedArguments(property.typedArguments);
+
+		for (std::string const& argument : property.arguments)
+		{
+			_propertyArguments.push_back(addString(argument));
+		}
+
+		_properties.push_back(propertyRecord);
+	}
+
+	_entities.push_back(record);
+
+	return entityIndex;
+}
+
+void ParsingResultWriter::closeEntity(uint32 entityIndex) noexcept
+{
+	_entities[entityIndex].subtreeEnd = static_cast<uint32>(_entities.size());
+}
+
+void ParsingResultWriter::addNamespace(NamespaceInfo const& namespaceInfo, uint32 outerEntity) noexcept
+{
+	uint32 entityIndex = addEntity(namespaceInfo, outerEntity);
+
+	for (NamespaceInfo const& nestedNamespace : namespaceInfo.namespaces)
+	{
+		addNamespace(nestedNamespace, entityIndex);
+	}
+
+	for (StructClassInfo const& structInfo : namespaceInfo.structs)
+	{
+		addStructClass(structInfo, entityIndex, EAccessSpecifier::Invalid);
+	}
+
+	for (StructClassInfo const& classInfo : namespaceInfo.classes)
+	{
+		addStructClass(classInfo, entityIndex, EAccessSpecifier::Invalid);
+	}
+
+	for (EnumInfo const& enumInfo : namespaceInfo.enums)
+	{
+		addEnum(enumInfo, entityIndex, EAccessSpecifier::Invalid);
+	}
+
+	for (FunctionInfo const& function : namespaceInfo.functions)
+	{
+		addFunction(function, entityIndex);
+	}
+
+	for (VariableInfo const& variable : namespaceInfo.variables)
+	{
+		addVariable(variable, entityIndex);
+	}
+
+	closeEntity(entityIndex);
+}
+
+void ParsingResultWriter::addStructClass(StructClassInfo const& structClass, uint32 outerEntity, EAccessSpecifier accessSpecifier) noexcept
+{
+	uint32	entityIndex	= addEntity(structClass, outerEntity, accessSpecifier);
+	uint32	type		= addType(structClass.type);
+	uint32	firstParent	= static_cast<uint32>(_parents.size());
+
+	for (StructClassInfo::ParentInfo const& parent : structClass.parents)
+	{
+		ParsedFileFormat::ParentRecord parentRecord{};
+
+		parentRecord.type				= addType(parent.type);
+		parentRecord.inheritanceAccess	= parent.inheritanceAccess;
+
+		_parents.push_back(parentRecord);
+	}
+
+	ParsedFileFormat::EntityRecord& record = _entities[entityIndex];
+
+	record.flags		= toFlag(structClass.qualifiers.isFinal, EEntityFlags::IsFinal) |
+						  toFlag(structClass.isForwardDeclaration, EEntityFlags::IsForwardDeclaration) |
+						  toFlag(structClass.isImportExport, EEntityFlags::IsImportExport);
+	record.type			= type;
+	record.firstParent	= firstParent;
+	record.parentCount	= static_cast<uint32>(structClass.parents.size());
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : structClass.nestedClasses)
+	{
+		addStructClass(*nestedClass, entityIndex, nestedClass->accessSpecifier);
+	}
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : structClass.nestedStructs)
+	{
+		addStructClass(*nestedStruct, entityIndex, nestedStruct->accessSpecifier);
+	}
+
+	for (NestedEnumInfo const& nestedEnum : structClass.nestedEnums)
+	{
+		addEnum(nestedEnum, entityIndex, nestedEnum.accessSpecifier);
+	}
+
+	for (FieldInfo const& field : structClass.fields)
+	{
+		addField(field, entityIndex);
+	}
+
+	for (MethodInfo const& method : structClass.methods)
+	{
+		addMethod(method, entityIndex);
+	}
+
+	closeEntity(entityIndex);
+}
+
+void ParsingResultWriter::addEnum(EnumInfo const& enumInfo, uint32 outerEntity, EAccessSpecifier accessSpecifier) noexcept
+{
+	uint32	entityIndex		= addEntity(enumInfo, outerEntity, accessSpecifier);
+	uint32	type			= addType(enumInfo.type);
+	uint32	underlyingType	= addType(enumInfo.underlyingType);
+
+	_entities[entityIndex].type				= type;
+	_entities[entityIndex].underlyingType	= underlyingType;
+
+	for (EnumValueInfo const& enumValue : enumInfo.enumValues)
+	{
+		addEnumValue(enumValue, entityIndex);
+	}
+
+	closeEntity(entityIndex);
+}
+
+void ParsingResultWriter::addEnumValue(EnumValueInfo const& enumValue, uint32 outerEntity) noexcept
+{
+	uint32 entityIndex = addEntity(enumValue, outerEntity);
+
+	_entities[entityIndex].value = enumValue.value;
+}
+
+void ParsingResultWriter::addVariable(VariableInfo const& variable, uint32 outerEntity) noexcept
+{
+	uint32	entityIndex	= addEntity(variable, outerEntity);
+	uint32	type		= addType(variable.type);
+
+	_entities[entityIndex].flags	= toFlag(variable.isStatic, EEntityFlags::IsStatic);
+	_entities[entityIndex].type		= type;
+}
+
+void ParsingResultWriter::addField(FieldInfo const& field, uint32 outerEntity) noexcept
+{
+	uint32	entityIndex	= addEntity(field, outerEntity, field.accessSpecifier);
+	uint32	type		= addType(field.type);
+
+	_entities[entityIndex].flags	= toFlag(field.isStatic, EEntityFlags::IsStatic) |
+									  toFlag(field.isMutable, EEntityFlags::IsMutable);
+	_entities[entityIndex].type		= type;
+	_entities[entityIndex].value	= field.memoryOffset;
+}
+
+void ParsingResultWriter::addFunction(FunctionInfo const& function, uint32 outerEntity) noexcept
+{
+	uint32	entityIndex		= addEntity(function, outerEntity);
+	uint32	prototype		= addString(function.prototype);
+	uint32	returnType		= addType(function.returnType);
+	uint32	firstParameter	= static_cast<uint32>(_functionParams.size());
+
+	for (FunctionParamInfo const& parameter : function.parameters)
+	{
+		ParsedFileFormat::FunctionParamRecord parameterRecord{};
+
+		parameterRecord.type	= addType(parameter.type);
+		parameterRecord.name	= addString(parameter.name);
+
+		_functionParams.push_back(parameterRecord);
+	}
+
+	ParsedFileFormat::EntityRecord& record = _entities[entityIndex];
+
+	record.flags			= toFlag(function.isInline, EEntityFlags::IsInline) |
+							  toFlag(function.isStatic, EEntityFlags::IsStatic);
+	record.prototype		= prototype;
+	record.type				= returnType;
+	record.firstParameter	= firstParameter;
+	record.parameterCount	= static_cast<uint32>(function.parameters.size());
+}
+
+void ParsingResultWriter::addMethod(MethodInfo const& method, uint32 outerEntity) noexcept
+{
+	uint32 entityIndex = static_cast<uint32>(_entities.size());
+
+	addFunction(method, outerEntity);
+
+	ParsedFileFormat::EntityRecord& record = _entities[entityIndex];
+
+	record.accessSpecifier	= method.accessSpecifier;
+	record.flags			|= toFlag(method.isDefault, EEntityFlags::IsDefault) |
+							   toFlag(method.isVirtual, EEntityFlags::IsVirtual) |
+							   toFlag(method.isPureVirtual, EEntityFlags::IsPureVirtual) |
+							   toFlag(method.isOverride, EEntityFlags::IsOverride) |
+							   toFlag(method.isFinal, EEntityFlags::IsFinal) |
+							   toFlag(method.isConst, EEntityFlags::IsConst);
+}
+
+void ParsingResultWriter::addStructClassTree(StructClassTree const& structClassTree) noexcept
+{
+	//Only inheritance links are written: the reader adds them back to a tree and rebuilds it
+	uint32 nodeCount = static_cast<uint32>(structClassTree.getNodeCount());
+
+	for (StructClassTree::NodeId node = 0u; node < nodeCount; node++)
+	{
+		_structClassTreeNodes.push_back(addString(structClassTree.getNodeName(node).str()));
+
+		for (StructClassTree::InheritanceLink const& parent : structClassTree.getParents(node))
+		{
+			ParsedFileFormat::StructClassTreeLinkRecord linkRecord{};
+
+			linkRecord.child				= static_cast<uint32>(node);
+			linkRecord.parent				= static_cast<uint32>(parent.inheritedStructClass);
+			linkRecord.inheritanceAccess	= parent.inheritanceAccess;
+
+			_structClassTreeLinks.push_back(linkRecord);
+		}
+	}
+}
+
+void ParsingResultWriter::write(FileParsingResult const& result) noexcept
+{
+	using ESection = ParsedFileFormat::ESection;
+
+	assert(result.errors.empty());
+
+	clear();
+
+	ParsedFileFormat::Header header{};
+
+	std::memcpy(header.magic, ParsedFileFormat::magic, sizeof(ParsedFileFormat::magic));
+	header.version		= ParsedFileFormat::version;
+	header.parsedFile	= addString(result.parsedFile.string());
+
+	for (NamespaceInfo const& namespaceInfo : result.namespaces)
+	{
+		addNamespace(namespaceInfo, ParsedFileFormat::invalidIndex);
+	}
+
+	for (StructClassInfo const& classInfo : result.classes)
+	{
+		addStructClass(classInfo, ParsedFileFormat::invalidIndex, EAccessSpecifier::Invalid);
+	}
+
+	for (StructClassInfo const& structInfo : result.structs)
+	{
+		addStructClass(structInfo, ParsedFileFormat::invalidIndex, EAccessSpecifier::Invalid);
+	}
+
+	for (EnumInfo const& enumInfo : result.enums)
+	{
+		addEnum(enumInfo, ParsedFileFormat::invalidIndex, EAccessSpecifier::Invalid);
+	}
+
+	for (FunctionInfo const& function : result.functions)
+	{
+		addFunction(function, ParsedFileFormat::invalidIndex);
+	}
+
+	for (VariableInfo const& variable : result.variables)
+	{
+		addVariable(variable, ParsedFileFormat::invalidIndex);
+	}
+
+	for (fs::path const& includedFile : result.includedFiles)
+	{
+		_includedFiles.push_back(addString(includedFile.string()));
+	}
+
+	addStructClassTree(result.structClassTree);
+
+	//The header is written last, once all section offsets are known
+	_data.resize(sizeof(ParsedFileFormat::Header), '\0');
+
+	writeSection(ESection::StringOffsets, _stringOffsets, header);
+	writeSection(ESection::StringData, _stringData, header);
+	writeSection(ESection::Entities, _entities, header);
+	writeSection(ESection::Types, _types, header);
+	writeSection(ESection::TemplateParams, _templateParams, header);
+	writeSection(ESection::TypeParts, _typeParts, header);
+	writeSection(ESection::Properties, _properties, header);
+	writeSection(ESection::PropertyArguments, _propertyArguments, header);
+	writeSection(ESection::TypedArguments, _typedArguments, header);
+	writeSection(ESection::Parents, _parents, header);
+	writeSection(ESection::FunctionParams, _functionParams, header);
+	writeSection(ESection::IncludedFiles, _includedFiles, header);
+	writeSection(ESection::StructClassTreeNodes, _structClassTreeNodes, header);
+	writeSection(ESection::StructClassTreeLinks, _structClassTreeLinks, header);
+
+	std::memcpy(_data.data(), &header, sizeof(ParsedFileFormat::Header));
+}
+
+std::string const& ParsingResultWriter::getData() const noexcept
+{
+	return _data;
+}
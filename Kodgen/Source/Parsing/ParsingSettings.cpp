@@ -1,9 +1,15 @@
 #include "Kodgen/Parsing/ParsingSettings.h"
 
+#include <fstream>
+
+#include <clang-c/Index.h>
+
+#include "Kodgen/CodeGen/GenerationManifest.h"	//GenerationManifest::computeHash
 #include "Kodgen/Misc/CompilerHelpers.h"
 #include "Kodgen/Misc/TomlUtility.h"
 #include "Kodgen/Misc/ILogger.h"
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/System.h"
 
 using namespace kodgen;
 
@@ -24,6 +30,8 @@ opt::optional<ECppVersion> ParsingSettings::getMatchingCppVersion(uint8 cppVersi
 
 void ParsingSettings::init(ILogger* logger) noexcept
 {
+	_logger = logger;
+
 	refreshCompilationArguments(logger);
 }
 
@@ -99,7 +107,7 @@ void ParsingSettings::refreshCompilationArguments(ILogger* logger) noexcept
 													*	9 because we make an additional parameter per possible entity
 													*	Namespace, Class, Struct, Variable, Field, Function, Method, Enum, EnumValue
 													*/
-	_compilationArguments.reserve(baseCompilationArgCount + 9u + _projectIncludeDirs.size());
+	_compilationArguments.reserve(baseCompilationArgCount + 9u + _projectIncludeDirs.size() + 2u);
 
 	//Parsing C++
 	_compilationArguments.emplace_back("-xc++");
@@ -128,6 +136,267 @@ void ParsingSettings::refreshCompilationArguments(ILogger* logger) noexcept
 	{
 		_compilationArguments.emplace_back(includeDir.data());
 	}
+
+	//The PCH must be built with the exact same arguments as the translation units using it, so add it last
+	if (!_prefixHeader.empty() && buildPrecompiledHeader(_compilationArguments, _precompiledHeaderPath, logger))
+	{
+		_compilationArguments.emplace_back("-include-pch");
+		_compilationArguments.emplace_back(_precompiledHeaderPath.data());
+	}
+
+	refreshTargetCompilationArguments(logger);
+}
+
+void ParsingSettings::refreshTargetCompilationArguments(ILogger* logger) noexcept
+{
+	_targetCompilationArguments.clear();
+	_targetPrecompiledHeaders.clear();
+	_compilationDatabase.clear();
+
+	if (_compilationDatabasePath.empty() || !_compilationDatabase.load(_compilationDatabasePath, logger))
+	{
+		return;
+	}
+
+	//The PCH arguments, which are always the last 2 arguments when used, are not shared with targets
+	size_t baseArgumentCount = _compilationArguments.size() - (_precompiledHeaderPath.empty() ? 0u : 2u);
+
+	_targetCompilationArguments.reserve(_compilationDatabase.getArgumentSets().size());
+
+	for (std::vector<std::string> const& targetArguments : _compilationDatabase.getArgumentSets())
+	{
+		std::vector<char const*>& compilationArguments = _targetCompilationArguments.emplace_back();
+
+		compilationArguments.reserve(baseArgumentCount + targetArguments.size());
+		compilationArguments.insert(compilationArguments.end(), _compilationArguments.cbegin(), _compilationArguments.cbegin() + baseArgumentCount);
+
+		for (std::string const& targetArgument : targetArguments)
+		{
+			compilationArguments.emplace_back(targetArgument.data());
+		}
+
+		//Target macros and include directories change the prefix header content, so each target gets its own PCH.
+		//Many targets of a compilation database don't own any parsed file, so the PCH is only built on first use
+		if (!_prefixHeader.empty())
+		{
+			_targetPrecompiledHeaders.emplace_back(std::make_shared<TargetPrecompiledHeader>());
+		}
+	}
+}
+
+std::vector<char const*> const& ParsingSettings::getTargetPrecompiledHeaderArguments(size_t argumentSetIndex) const noexcept
+{
+	TargetPrecompiledHeader& targetPrecompiledHeader = *_targetPrecompiledHeaders[argumentSetIndex];
+
+	//Threads parsing files of the same target wait for its PCH, while other targets PCHs are built in parallel
+	std::lock_guard lock(targetPrecompiledHeader.mutex);
+
+	if (!targetPrecompiledHeader.isBuilt)
+	{
+		targetPrecompiledHeader.compilationArguments = _targetCompilationArguments[argumentSetIndex];
+
+		if (buildPrecompiledHeader(targetPrecompiledHeader.compilationArguments, targetPrecompiledHeader.path, _logger))
+		{
+			targetPrecompiledHeader.compilationArguments.emplace_back("-include-pch");
+			targetPrecompiledHeader.compilationArguments.emplace_back(targetPrecompiledHeader.path.data());
+		}
+
+		targetPrecompiledHeader.isBuilt = true;
+	}
+
+	return targetPrecompiledHeader.compilationArguments;
+}
+
+fs::path ParsingSettings::computePrecompiledHeaderPath(std::vector<char const*> const& compilationArguments) const noexcept
+{
+	fs::path cacheDirectory = System::getUserCacheDirectory();
+
+	if (cacheDirectory.empty())
+	{
+		return fs::path();
+	}
+
+	//Name the PCH after everything it depends on, so that different projects, targets and libclang versions don't share a PCH.
+	//The hash must be stable between runs for the PCH to be reused
+	CXString	clangVersion	= clang_getClangVersion();
+	uint64		key				= GenerationManifest::computeHash(clang_getCString(clangVersion));
+
+	clang_disposeString(clangVersion);
+
+	std::string prefixHeader = _prefixHeader.string();
+
+	//Hash the null terminators as well so that argument boundaries are part of the key
+	key = GenerationManifest::computeHash(std::string_view(prefixHeader.c_str(), prefixHeader.size() + 1u), key);
+
+	for (char const* compilationArgument : compilationArguments)
+	{
+		key = GenerationManifest::computeHash(std::string_view(compilationArgument, std::char_traits<char>::length(compilationArgument) + 1u), key);
+	}
+
+	return cacheDirectory / ("Prefix_" + std::to_string(key) + ".pch");
+}
+
+bool ParsingSettings::buildPrecompiledHeader(std::vector<char const*> const& compilationArguments, std::string& out_precompiledHeaderPath, ILogger* logger) const noexcept
+{
+	out_precompiledHeaderPath.clear();
+
+	fs::path precompiledHeaderPath = computePrecompiledHeaderPath(compilationArguments);
+
+	if (precompiledHeaderPath.empty())
+	{
+		if (logger != nullptr)
+		{
+			logger->log("Could not precompile the prefix header: no user cache directory is available.", ILogger::ELogSeverity::Warning);
+		}
+
+		return false;
+	}
+
+	if (isPrecompiledHeaderUpToDate(precompiledHeaderPath))
+	{
+		out_precompiledHeaderPath = precompiledHeaderPath.string();
+
+		return true;
+	}
+
+	//Save to a temporary file first so that a concurrent run never reads a partially written PCH
+	fs::path	temporaryPath	= FilesystemHelpers::makeTemporaryPath(precompiledHeaderPath);
+
+	CXIndex		index			= clang_createIndex(0, 0);
+	bool		result			= false;
+	std::string	inputs;
+
+	CXTranslationUnit translationUnit = clang_parseTranslationUnit(index, _prefixHeader.string().c_str(), compilationArguments.data(), static_cast<int32>(compilationArguments.size()), nullptr, 0, CXTranslationUnit_ForSerialization | CXTranslationUnit_Incomplete);
+
+	if (translationUnit != nullptr)
+	{
+		result = clang_saveTranslationUnit(translationUnit, temporaryPath.string().c_str(), CXSaveTranslationUnit_None) == CXSaveError_None;
+
+		//Record the last write time of every file the PCH was built from, to know when it must be rebuilt
+		clang_getInclusions(translationUnit, [](CXFile includedFile, CXSourceLocation*, unsigned, CXClientData clientData)
+							{
+								CXString	fileName	= clang_getFileName(includedFile);
+								fs::path	filePath	= clang_getCString(fileName);
+
+								clang_disposeString(fileName);
+
+								*reinterpret_cast<std::string*>(clientData) += getLastWriteTimeStamp(filePath) + " " + filePath.string() + "\n";
+							}, &inputs);
+
+		clang_disposeTranslationUnit(translationUnit);
+	}
+
+	clang_disposeIndex(index);
+
+	std::error_code errorCode;
+
+	fs::path inputsPath = precompiledHeaderPath;
+	inputsPath += ".inputs";
+
+	fs::path temporaryInputsPath = FilesystemHelpers::makeTemporaryPath(inputsPath);
+
+	if (result)
+	{
+		std::ofstream inputsStream(temporaryInputsPath, std::ios::out | std::ios::trunc);
+
+		inputsStream << inputs;
+		inputsStream.close();
+
+		result = inputsStream.good();
+	}
+
+	//The inputs file is replaced after the PCH, so that inputs listing the files of the new PCH never describe an outdated PCH
+	if (result)
+	{
+		fs::rename(temporaryPath, precompiledHeaderPath, errorCode);
+
+		result = !errorCode;
+	}
+
+	if (result)
+	{
+		fs::rename(temporaryInputsPath, inputsPath, errorCode);
+
+		result = !errorCode;
+	}
+
+	if (result)
+	{
+		out_precompiledHeaderPath = precompiledHeaderPath.string();
+	}
+	else
+	{
+		fs::remove(temporaryPath, errorCode);
+		fs::remove(temporaryInputsPath, errorCode);
+
+		if (logger != nullptr)
+		{
+			logger->log("Failed to precompile the prefix header " + _prefixHeader.string() + ". Files will be parsed without precompiled header.", ILogger::ELogSeverity::Warning);
+		}
+	}
+
+	return result;
+}
+
+bool ParsingSettings::isPrecompiledHeaderUpToDate(fs::path const& precompiledHeaderPath) noexcept
+{
+	std::error_code								errorCode;
+	std::vector<std::pair<std::string, fs::path>>	inputs;
+
+	if (!fs::is_regular_file(precompiledHeaderPath, errorCode) || !readPrecompiledHeaderInputs(precompiledHeaderPath, inputs) || inputs.empty())
+	{
+		return false;
+	}
+
+	for (auto const& [lastWriteTimeStamp, inputPath] : inputs)
+	{
+		std::string currentLastWriteTimeStamp = getLastWriteTimeStamp(inputPath);
+
+		if (currentLastWriteTimeStamp.empty() || currentLastWriteTimeStamp != lastWriteTimeStamp)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ParsingSettings::readPrecompiledHeaderInputs(fs::path const& precompiledHeaderPath, std::vector<std::pair<std::string, fs::path>>& out_inputs) noexcept
+{
+	fs::path inputsPath = precompiledHeaderPath;
+	inputsPath += ".inputs";
+
+	std::ifstream inputsStream(inputsPath);
+
+	if (!inputsStream.is_open())
+	{
+		return false;
+	}
+
+	std::string line;
+
+	//Each line is the last write time of an input followed by its path
+	while (std::getline(inputsStream, line))
+	{
+		size_t separatorIndex = line.find(' ');
+
+		if (separatorIndex == std::string::npos)
+		{
+			return false;
+		}
+
+		out_inputs.emplace_back(line.substr(0u, separatorIndex), line.substr(separatorIndex + 1u));
+	}
+
+	return true;
+}
+
+std::string ParsingSettings::getLastWriteTimeStamp(fs::path const& file) noexcept
+{
+	std::error_code		errorCode;
+	fs::file_time_type	lastWriteTime = fs::last_write_time(file, errorCode);
+
+	return errorCode ? std::string() : std::to_string(lastWriteTime.time_since_epoch().count());
 }
 
 bool ParsingSettings::loadSettingsValues(toml::value const& tomlData, ILogger* logger) noexcept
@@ -142,6 +411,8 @@ bool ParsingSettings::loadSettingsValues(toml::value const& tomlData, ILogger* l
 		loadShouldLogDiagnostic(tomlParsingSettings, logger);
 		loadCompilerExeName(tomlParsingSettings, logger);
 		loadProjectIncludeDirectories(tomlParsingSettings, logger);
+		loadPrefixHeader(tomlParsingSettings, logger);
+		loadCompilationDatabasePath(tomlParsingSettings, logger);
 
 		return propertyParsingSettings.loadSettingsValues(tomlParsingSettings, logger);
 	}
@@ -298,6 +569,50 @@ void ParsingSettings::loadProjectIncludeDirectories(toml::value const& parsingSe
 	}
 }
 
+void ParsingSettings::loadPrefixHeader(toml::value const& parsingSettings, ILogger* logger) noexcept
+{
+	fs::path prefixHeader;
+
+	if (TomlUtility::updateSetting(parsingSettings, "prefixHeader", prefixHeader, logger))
+	{
+		bool success = setPrefixHeader(prefixHeader);
+
+		if (logger != nullptr)
+		{
+			if (success)
+			{
+				logger->log("[TOML] Load prefix header: " + _prefixHeader.string());
+			}
+			else
+			{
+				logger->log("[TOML] Discard prefix header as it doesn't exist or is not a file: " + prefixHeader.string(), ILogger::ELogSeverity::Warning);
+			}
+		}
+	}
+}
+
+void ParsingSettings::loadCompilationDatabasePath(toml::value const& parsingSettings, ILogger* logger) noexcept
+{
+	fs::path compilationDatabasePath;
+
+	if (TomlUtility::updateSetting(parsingSettings, "compilationDatabase", compilationDatabasePath, logger))
+	{
+		bool success = setCompilationDatabasePath(compilationDatabasePath);
+
+		if (logger != nullptr)
+		{
+			if (success)
+			{
+				logger->log("[TOML] Load compilation database: " + _compilationDatabasePath.string());
+			}
+			else
+			{
+				logger->log("[TOML] Discard compilation database as no compile_commands.json could be found at: " + compilationDatabasePath.string(), ILogger::ELogSeverity::Warning);
+			}
+		}
+	}
+}
+
 bool ParsingSettings::addProjectIncludeDirectory(fs::path const& directoryPath) noexcept
 {
 	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(directoryPath);
@@ -330,11 +645,80 @@ std::string const& ParsingSettings::getCompilerExeName() const noexcept
 	return _compilerExeName;
 }
 
+fs::path const& ParsingSettings::getPrefixHeader() const noexcept
+{
+	return _prefixHeader;
+}
+
 std::vector<char const*> const& ParsingSettings::getCompilationArguments() const noexcept
 {
 	return _compilationArguments;
 }
 
+std::vector<char const*> const& ParsingSettings::getCompilationArguments(fs::path const& file) const noexcept
+{
+	if (!_targetCompilationArguments.empty())
+	{
+		size_t argumentSetIndex = _compilationDatabase.findArgumentSetIndex(file);
+
+		if (argumentSetIndex < _targetCompilationArguments.size())
+		{
+			return _targetPrecompiledHeaders.empty() ? _targetCompilationArguments[argumentSetIndex] : getTargetPrecompiledHeaderArguments(argumentSetIndex);
+		}
+	}
+
+	return _compilationArguments;
+}
+
+std::vector<std::vector<char const*>> const& ParsingSettings::getTargetCompilationArguments() const noexcept
+{
+	return _targetCompilationArguments;
+}
+
+std::string ParsingSettings::getPrecompiledHeaderInputsStamp() const noexcept
+{
+	std::string result;
+
+	auto appendInputsStamp = [&result](fs::path const& precompiledHeaderPath)
+	{
+		std::vector<std::pair<std::string, fs::path>> inputs;
+
+		result += precompiledHeaderPath.string() + "\n";
+
+		//Current last write times, so that an outdated PCH gives the same stamp as once it is rebuilt
+		if (readPrecompiledHeaderInputs(precompiledHeaderPath, inputs))
+		{
+			for (auto const& [lastWriteTimeStamp, inputPath] : inputs)
+			{
+				result += getLastWriteTimeStamp(inputPath) + " " + inputPath.string() + "\n";
+			}
+		}
+	};
+
+	if (!_precompiledHeaderPath.empty())
+	{
+		appendInputsStamp(_precompiledHeaderPath);
+	}
+
+	//Target PCHs are named after their arguments, so their path is known before they are built
+	for (size_t i = 0u; i < _targetPrecompiledHeaders.size(); i++)
+	{
+		fs::path precompiledHeaderPath = computePrecompiledHeaderPath(_targetCompilationArguments[i]);
+
+		if (!precompiledHeaderPath.empty())
+		{
+			appendInputsStamp(precompiledHeaderPath);
+		}
+	}
+
+	return result;
+}
+
+fs::path const& ParsingSettings::getCompilationDatabasePath() const noexcept
+{
+	return _compilationDatabasePath;
+}
+
 bool ParsingSettings::setCompilerExeName(std::string const& compilerExeName) noexcept
 {
 	if (CompilerHelpers::isSupportedCompiler(compilerExeName))
@@ -344,5 +728,53 @@ bool ParsingSettings::setCompilerExeName(std::string const& compilerExeName) noe
 		return true;
 	}
 
+	return false;
+}
+
+bool ParsingSettings::setPrefixHeader(fs::path const& prefixHeader) noexcept
+{
+	if (prefixHeader.empty())
+	{
+		_prefixHeader.clear();
+
+		return true;
+	}
+
+	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(prefixHeader);
+
+	if (!sanitizedPath.empty() && fs::is_regular_file(sanitizedPath))
+	{
+		_prefixHeader = std::move(sanitizedPath);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool ParsingSettings::setCompilationDatabasePath(fs::path const& compilationDatabasePath) noexcept
+{
+	if (compilationDatabasePath.empty())
+	{
+		_compilationDatabasePath.clear();
+
+		return true;
+	}
+
+	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(compilationDatabasePath);
+
+	//Accept both the compile_commands.json file and its directory
+	if (!sanitizedPath.empty() && fs::is_directory(sanitizedPath))
+	{
+		sanitizedPath /= "compile_commands.json";
+	}
+
+	if (!sanitizedPath.empty() && fs::is_regular_file(sanitizedPath))
+	{
+		_compilationDatabasePath = std::move(sanitizedPath);
+
+		return true;
+	}
+
 	return false;
 }
\ No newline at end of file
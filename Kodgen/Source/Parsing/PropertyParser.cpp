@@ -1,18 +1,23 @@
 #include "Kodgen/Parsing/PropertyParser.h"
 
 #include <cassert>
+#include <cctype>		//std::isalpha, std::isalnum
+#include <cstdlib>		//std::strtod
+#include <charconv>		//std::from_chars
 
 #include "Kodgen/Properties/Property.h"
 
 using namespace kodgen;
 
-opt::optional<std::vector<Property>> PropertyParser::getProperties(std::string&& annotateMessage, std::string const& annotationId) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getProperties(std::string_view annotateMessage, std::string_view annotationId) noexcept
 {
 	if (annotateMessage.substr(0, annotationId.size()) == annotationId)
 	{
-		if (splitProperties(annotateMessage.substr(annotationId.size())))
+		std::vector<Property> result;
+
+		if (splitProperties(annotateMessage.substr(annotationId.size()), result))
 		{
-			return fillProperties(_splitProps);
+			return result;
 		}
 	}
 	else
@@ -24,70 +29,70 @@ opt::optional<std::vector<Property>> PropertyParser::getProperties(std::string&&
 	return opt::nullopt;
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getNamespaceProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getNamespaceProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string namespaceAnnotation = "KGN:";
+	static constexpr std::string_view namespaceAnnotation = "KGN:";
 
-	return getProperties(std::move(annotateMessage), namespaceAnnotation);
+	return getProperties(annotateMessage, namespaceAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getClassProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getClassProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string classAnnotation = "KGC:";
+	static constexpr std::string_view classAnnotation = "KGC:";
 
-	return getProperties(std::move(annotateMessage), classAnnotation);
+	return getProperties(annotateMessage, classAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getStructProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getStructProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string structAnnotation = "KGS:";
+	static constexpr std::string_view structAnnotation = "KGS:";
 
-	return getProperties(std::move(annotateMessage), structAnnotation);
+	return getProperties(annotateMessage, structAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getVariableProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getVariableProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string variableAnnotation = "KGV:";
+	static constexpr std::string_view variableAnnotation = "KGV:";
 
-	return getProperties(std::move(annotateMessage), variableAnnotation);
+	return getProperties(annotateMessage, variableAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getFieldProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getFieldProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string fieldAnnotation = "KGF:";
+	static constexpr std::string_view fieldAnnotation = "KGF:";
 
-	return getProperties(std::move(annotateMessage), fieldAnnotation);
+	return getProperties(annotateMessage, fieldAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getFunctionProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getFunctionProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string functionAnnotation = "KGFu:";
+	static constexpr std::string_view functionAnnotation = "KGFu:";
 
-	return getProperties(std::move(annotateMessage), functionAnnotation);
+	return getProperties(annotateMessage, functionAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getMethodProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getMethodProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string methodAnnotation = "KGM:";
+	static constexpr std::string_view methodAnnotation = "KGM:";
 
-	return getProperties(std::move(annotateMessage), methodAnnotation);
+	return getProperties(annotateMessage, methodAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getEnumProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getEnumProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string enumAnnotation = "KGE:";
+	static constexpr std::string_view enumAnnotation = "KGE:";
 
-	return getProperties(std::move(annotateMessage), enumAnnotation);
+	return getProperties(annotateMessage, enumAnnotation);
 }
 
-opt::optional<std::vector<Property>> PropertyParser::getEnumValueProperties(std::string annotateMessage) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getEnumValueProperties(std::string_view annotateMessage) noexcept
 {
-	static std::string enumValueAnnotation = "KGEV:";
+	static constexpr std::string_view enumValueAnnotation = "KGEV:";
 
-	return getProperties(std::move(annotateMessage), enumValueAnnotation);
+	return getProperties(annotateMessage, enumValueAnnotation);
 }
 
-bool PropertyParser::splitProperties(std::string&& propertiesString) noexcept
+bool PropertyParser::splitProperties(std::string_view propertiesString, std::vector<Property>& out_properties) noexcept
 {
 	bool isParsingArgument = false;
 
@@ -95,12 +100,12 @@ bool PropertyParser::splitProperties(std::string&& propertiesString) noexcept
 	{
 		if (isParsingArgument)
 		{
-			if (!lookForNextPropertyArgument(propertiesString, isParsingArgument))
+			if (!lookForNextPropertyArgument(propertiesString, isParsingArgument, out_properties))
 			{
 				return false;
 			}
 		}
-		else if (!lookForNextProperty(propertiesString, isParsingArgument))
+		else if (!lookForNextProperty(propertiesString, isParsingArgument, out_properties))
 		{
 			return false;
 		}
@@ -117,41 +122,38 @@ bool PropertyParser::splitProperties(std::string&& propertiesString) noexcept
 	return true;
 }
 
-bool PropertyParser::lookForNextProperty(std::string& inout_parsingProps, bool& out_isParsingSubProp) noexcept
+bool PropertyParser::lookForNextProperty(std::string_view& inout_parsingProps, bool& out_isParsingSubProp, std::vector<Property>& out_properties) noexcept
 {
 	//Find first occurence of propertySeparator or subprop start encloser in string
 	size_t index = inout_parsingProps.find_first_of(_relevantCharsForPropParsing);
 
+	out_properties.emplace_back().name = trimSpaces(inout_parsingProps.substr(0u, index));
+
 	//Was last prop
 	if (index == inout_parsingProps.npos)
 	{
-		_splitProps.push_back({ inout_parsingProps });
-		inout_parsingProps.clear();
-	}
-	else if (inout_parsingProps[index] == _propertyParsingSettings->propertySeparator)
-	{
-		_splitProps.push_back({ std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index) });
-		inout_parsingProps.erase(0, index + 1);
+		inout_parsingProps = std::string_view();
 	}
-	else	//_propertyParsingSettings->subPropertyEnclosers[0]
+	else
 	{
-		out_isParsingSubProp = true;
+		//_propertyParsingSettings->subPropertyEnclosers[0]
+		if (inout_parsingProps[index] != _propertyParsingSettings->propertySeparator)
+		{
+			out_isParsingSubProp = true;
+		}
 
-		_splitProps.push_back({ std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index) });
-		inout_parsingProps.erase(0, index + 1);
+		inout_parsingProps.remove_prefix(index + 1u);
 	}
 
-	//Remove start and trail spaces from the added property
-	removeStartSpaces(_splitProps.back().front());
-	removeTrailSpaces(_splitProps.back().front());
-
 	return true;
 }
 
-bool PropertyParser::lookForNextPropertyArgument(std::string& inout_parsingProps, bool& out_isParsingSubProp) noexcept
+bool PropertyParser::lookForNextPropertyArgument(std::string_view& inout_parsingProps, bool& out_isParsingSubProp, std::vector<Property>& out_properties) noexcept
 {
-	//Find first occurence of propertySeparator or subprop start encloser in string
-	size_t index = inout_parsingProps.find_first_of(_relevantCharsForPropArgsParsing);
+	//Find first occurence of argumentSeparator or subprop end encloser in string
+	//Typed arguments can contain string literals and nested lists, so quotes and enclosers must be skipped
+	size_t index = _propertyParsingSettings->shouldParseTypedArguments ?	findNextArgumentDelimiter(inout_parsingProps) :
+																			inout_parsingProps.find_first_of(_relevantCharsForPropArgsParsing);
 
 	//Was last prop
 	if (index == inout_parsingProps.npos)
@@ -160,87 +162,263 @@ bool PropertyParser::lookForNextPropertyArgument(std::string& inout_parsingProps
 
 		return false;
 	}
-	else if (inout_parsingProps[index] == _propertyParsingSettings->argumentSeparator)
-	{
-		_splitProps.back().push_back(std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index));
 
-		//Remove start and trail spaces from the added sub property
-		removeStartSpaces(_splitProps.back().back());
-		removeTrailSpaces(_splitProps.back().back());
+	std::vector<std::string>& arguments = out_properties.back().arguments;
 
-		inout_parsingProps.erase(0, index + 1);
+	arguments.emplace_back(trimSpaces(inout_parsingProps.substr(0u, index)));
+
+	if (inout_parsingProps[index] == _propertyParsingSettings->argumentSeparator)
+	{
+		inout_parsingProps.remove_prefix(index + 1u);
 	}
 	else	//_propertyParsingSettings->subPropertyEnclosers[1]
 	{
 		out_isParsingSubProp = false;
 
-		_splitProps.back().push_back(std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index));
-
-		//Remove start and trail spaces from the added sub property
-		removeStartSpaces(_splitProps.back().back());
-		removeTrailSpaces(_splitProps.back().back());
+		//A single empty argument means there are no arguments at all, ex: Prop()
+		if (arguments.size() == 1u && arguments.front().empty())
+		{
+			arguments.clear();
+		}
 
-		//Make sure there is a property separator after the end encloser if is not the last char of the string
-		if (index != inout_parsingProps.size() - 1)
+		if (_propertyParsingSettings->shouldParseTypedArguments)
 		{
-			size_t propSeparatorIndex = inout_parsingProps.find_first_not_of(' ', index + 1);
+			std::vector<PropertyArgument>& typedArguments = out_properties.back().typedArguments;
 
-			if (inout_parsingProps[propSeparatorIndex] != _propertyParsingSettings->propertySeparator)
-			{
-				_parsingErrorDescription = "Property separator \"" + std::string(1, _propertyParsingSettings->propertySeparator) + "\" is missing between two properties.";
+			typedArguments.reserve(arguments.size());
 
-				return false;
-			}
-			else
+			for (std::string const& argument : arguments)
 			{
-				inout_parsingProps.erase(0, propSeparatorIndex + 1); // + 1 to consume prop separator
+				typedArguments.emplace_back(parseTypedArgument(argument));
 			}
 		}
+
+		//Make sure there is a property separator after the end encloser if it is not followed by spaces only
+		size_t propSeparatorIndex = inout_parsingProps.find_first_not_of(' ', index + 1u);
+
+		if (propSeparatorIndex == inout_parsingProps.npos)
+		{
+			//Consume the rest of the string
+			inout_parsingProps = std::string_view();
+		}
+		else if (inout_parsingProps[propSeparatorIndex] != _propertyParsingSettings->propertySeparator)
+		{
+			_parsingErrorDescription = "Property separator \"" + std::string(1, _propertyParsingSettings->propertySeparator) + "\" is missing between two properties.";
+
+			return false;
+		}
 		else
 		{
-			//index is the last character, so consume the rest of the string
-			inout_parsingProps.clear();
+			inout_parsingProps.remove_prefix(propSeparatorIndex + 1u); // + 1 to consume prop separator
 		}
 	}
 
 	return true;
 }
 
-void PropertyParser::removeStartSpaces(std::string& toCleanString) const noexcept
+size_t PropertyParser::findNextArgumentDelimiter(std::string_view arguments) const noexcept
 {
-	toCleanString.erase(0, toCleanString.find_first_not_of(' '));
-}
+	uint32	depth		= 0u;
+	bool	isInString	= false;
 
-void PropertyParser::removeTrailSpaces(std::string& toCleanString) const noexcept
-{
-	toCleanString.erase(toCleanString.find_last_not_of(' ') + 1);
+	for (size_t i = 0u; i < arguments.size(); i++)
+	{
+		char c = arguments[i];
+
+		if (isInString)
+		{
+			if (c == '\\')
+			{
+				i++;	//Skip escaped char
+			}
+			else if (c == '"')
+			{
+				isInString = false;
+			}
+		}
+		else if (c == '"')
+		{
+			isInString = true;
+		}
+		else if (c == _propertyParsingSettings->argumentEnclosers[0])
+		{
+			depth++;
+		}
+		else if (c == _propertyParsingSettings->argumentEnclosers[1])
+		{
+			if (depth == 0u)
+			{
+				return i;
+			}
+
+			depth--;
+		}
+		else if (c == _propertyParsingSettings->argumentSeparator && depth == 0u)
+		{
+			return i;
+		}
+	}
+
+	return std::string_view::npos;
 }
 
-std::vector<Property> PropertyParser::fillProperties(std::vector<std::vector<std::string>>& splitProps) noexcept
+PropertyArgument PropertyParser::parseTypedArgument(std::string_view argument) const noexcept
 {
-	std::vector<Property> result;
+	PropertyArgument result;
 
-	for (std::vector<std::string>& props : splitProps)
+	//List: (element1, element2, ...)
+	if (argument.size() >= 2u && argument.front() == _propertyParsingSettings->argumentEnclosers[0] && argument.back() == _propertyParsingSettings->argumentEnclosers[1])
 	{
-		addProperty(props, result);
+		std::string_view	elements	= argument.substr(1u, argument.size() - 2u);
+		bool				isList		= true;
+
+		result.type = EPropertyArgumentType::List;
+
+		while (!trimSpaces(elements).empty())
+		{
+			size_t index = findNextArgumentDelimiter(elements);
+
+			//The first encloser is closed before the end of the argument, ex: (a)(b)
+			if (index != elements.npos && elements[index] != _propertyParsingSettings->argumentSeparator)
+			{
+				isList = false;
+				break;
+			}
+
+			result.listValue.emplace_back(parseTypedArgument(trimSpaces(elements.substr(0u, index))));
+
+			if (index == elements.npos)
+			{
+				break;
+			}
+
+			elements.remove_prefix(index + 1u);
+		}
+
+		if (isList)
+		{
+			return result;
+		}
+
+		result.listValue.clear();
+	}
+
+	//Boolean
+	if (argument == "true" || argument == "false")
+	{
+		result.type			= EPropertyArgumentType::Boolean;
+		result.booleanValue	= (argument == "true");
+
+		return result;
+	}
+
+	//Integer: decimal or hexadecimal
+	{
+		std::string_view	digits		= argument;
+		bool				isNegative	= !digits.empty() && digits.front() == '-';
+		int					base		= 10;
+		uint64				value		= 0u;
+
+		if (!digits.empty() && (digits.front() == '-' || digits.front() == '+'))
+		{
+			digits.remove_prefix(1u);
+		}
+
+		if (digits.size() > 2u && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+		{
+			digits.remove_prefix(2u);
+			base = 16;
+		}
+
+		std::from_chars_result parsingResult = std::from_chars(digits.data(), digits.data() + digits.size(), value, base);
+
+		if (!digits.empty() && parsingResult.ec == std::errc() && parsingResult.ptr == digits.data() + digits.size() &&
+			value <= static_cast<uint64>(INT64_MAX) + (isNegative ? 1u : 0u))
+		{
+			result.type			= EPropertyArgumentType::Integer;
+			result.integerValue	= isNegative ? static_cast<int64>(0u - value) : static_cast<int64>(value);
+
+			return result;
+		}
+	}
+
+	//Identifier, possibly qualified
+	if (!argument.empty() && (std::isalpha(static_cast<unsigned char>(argument.front())) || argument.front() == '_' || argument.front() == ':'))
+	{
+		bool isIdentifier = true;
+
+		for (char c : argument)
+		{
+			if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != ':')
+			{
+				isIdentifier = false;
+				break;
+			}
+		}
+
+		if (isIdentifier)
+		{
+			result.type			= EPropertyArgumentType::Identifier;
+			result.stringValue	= argument;
+
+			return result;
+		}
+	}
+
+	//Floating point, with an optional f suffix
+	if (!argument.empty())
+	{
+		std::string_view	number	= (argument.back() == 'f' || argument.back() == 'F') ? argument.substr(0u, argument.size() - 1u) : argument;
+		std::string			numberString(number);
+		char*				end		= nullptr;
+		double				value	= std::strtod(numberString.c_str(), &end);
+
+		if (!numberString.empty() && end == numberString.c_str() + numberString.size())
+		{
+			result.type					= EPropertyArgumentType::FloatingPoint;
+			result.floatingPointValue	= value;
+
+			return result;
+		}
+	}
+
+	result.type = EPropertyArgumentType::String;
+
+	//String literal: remove quotes and resolve \" and \\ escape sequences
+	if (argument.size() >= 2u && argument.front() == '"' && argument.back() == '"')
+	{
+		std::string_view content = argument.substr(1u, argument.size() - 2u);
+
+		result.stringValue.reserve(content.size());
+
+		for (size_t i = 0u; i < content.size(); i++)
+		{
+			if (content[i] == '\\' && i + 1u < content.size() && (content[i + 1u] == '"' || content[i + 1u] == '\\'))
+			{
+				i++;
+			}
+
+			result.stringValue.push_back(content[i]);
+		}
+	}
+	else
+	{
+		result.stringValue = argument;
 	}
 
 	return result;
 }
 
-void PropertyParser::addProperty(std::vector<std::string>& propertyAsVector, std::vector<Property>& out_properties) noexcept
+std::string_view PropertyParser::trimSpaces(std::string_view toCleanString) noexcept
 {
-	Property prop{std::move(propertyAsVector[0]), std::vector<std::string>()};
+	size_t firstCharIndex = toCleanString.find_first_not_of(' ');
 
-	if (propertyAsVector.size() > 1u)
+	if (firstCharIndex == toCleanString.npos)
 	{
-		//Add all arguments to the property
-		//If propertyAsVector has 2 elements and the 2nd element is empty, there are no arguments
-		if (propertyAsVector.size() != 2 || !propertyAsVector[1].empty())
-			prop.arguments.insert(prop.arguments.cend(), std::make_move_iterator(propertyAsVector.begin() + 1), std::make_move_iterator(propertyAsVector.end()));
+		return std::string_view();
 	}
-	
-	out_properties.emplace_back(std::move(prop));
+
+	return toCleanString.substr(firstCharIndex, toCleanString.find_last_not_of(' ') - firstCharIndex + 1u);
 }
 
 void PropertyParser::setup(PropertyParsingSettings const& propertyParsingSettings) noexcept
@@ -265,7 +443,6 @@ void PropertyParser::setup(PropertyParsingSettings const& propertyParsingSetting
 
 void PropertyParser::clean() noexcept
 {
-	_splitProps.clear();
 	_parsingErrorDescription.clear();
 }
 
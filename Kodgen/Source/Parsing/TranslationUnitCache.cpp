@@ -0,0 +1,69 @@
+#include "Kodgen/Parsing/TranslationUnitCache.h"
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+using namespace kodgen;
+
+TranslationUnitCache::~TranslationUnitCache() noexcept
+{
+	clear();
+}
+
+void TranslationUnitCache::disposeEntry(CacheEntry& entry) noexcept
+{
+	if (entry.translationUnit != nullptr)
+	{
+		clang_disposeTranslationUnit(entry.translationUnit);
+		entry.translationUnit = nullptr;
+	}
+
+	if (entry.index != nullptr)
+	{
+		clang_disposeIndex(entry.index);
+		entry.index = nullptr;
+	}
+}
+
+CXTranslationUnit TranslationUnitCache::getTranslationUnit(fs::path const& file, std::vector<char const*> const& compilationArguments, unsigned int parsingOptions) noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	//References to unordered_map elements remain valid when other elements are inserted
+	CacheEntry& entry = _entries[file];
+
+	lock.unlock();
+
+	if (entry.translationUnit != nullptr)
+	{
+		//Reparse the cached translation unit, only the files modified since the last parsing are processed again
+		if (clang_reparseTranslationUnit(entry.translationUnit, 0u, nullptr, clang_defaultReparseOptions(entry.translationUnit)) == 0)
+		{
+			return entry.translationUnit;
+		}
+
+		//The translation unit is invalid after a failed reparse, parse it from scratch
+		clang_disposeTranslationUnit(entry.translationUnit);
+		entry.translationUnit = nullptr;
+	}
+
+	if (entry.index == nullptr)
+	{
+		entry.index = clang_createIndex(0, 0);
+	}
+
+	entry.translationUnit = clang_parseTranslationUnit(entry.index, file.string().c_str(), compilationArguments.data(), static_cast<int32>(compilationArguments.size()), nullptr, 0, parsingOptions | CXTranslationUnit_PrecompiledPreamble);
+
+	return entry.translationUnit;
+}
+
+void TranslationUnitCache::clear() noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	for (auto& [file, entry] : _entries)
+	{
+		disposeEntry(entry);
+	}
+
+	_entries.clear();
+}
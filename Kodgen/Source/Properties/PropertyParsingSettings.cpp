@@ -11,6 +11,7 @@ bool PropertyParsingSettings::loadSettingsValues(toml::value const& tomlData, IL
 	TomlUtility::updateSetting(tomlData, "argumentSeparator", argumentSeparator, logger);
 	TomlUtility::updateSetting(tomlData, "argumentStartEncloser", argumentEnclosers[0], logger);
 	TomlUtility::updateSetting(tomlData, "argumentEndEncloser", argumentEnclosers[1], logger);
+	TomlUtility::updateSetting(tomlData, "shouldParseTypedArguments", shouldParseTypedArguments, logger);
 
 	TomlUtility::updateSetting(tomlData, "namespaceMacroName", namespaceMacroName, logger);
 	TomlUtility::updateSetting(tomlData, "classMacroName", classMacroName, logger);
@@ -4,11 +4,65 @@ using namespace kodgen;
 
 TaskBase::TaskBase(char const* name, std::vector<std::shared_ptr<TaskBase>>&& deps) noexcept:
 	_name{name},
+	_pendingDependenciesCount{deps.size()},
 	dependencies{std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps)}
 {
 }
 
+bool TaskBase::addContinuation(std::shared_ptr<TaskBase> const& continuation) noexcept
+{
+	std::lock_guard lock(_continuationsMutex);
+
+	if (_isCompleted)
+	{
+		return false;
+	}
+
+	_continuations.emplace_back(continuation);
+
+	return true;
+}
+
+std::vector<std::shared_ptr<TaskBase>> TaskBase::complete() noexcept
+{
+	std::unique_lock lock(_continuationsMutex);
+
+	_isCompleted = true;
+
+	std::vector<std::shared_ptr<TaskBase>> result = std::move(_continuations);
+
+	lock.unlock();
+
+	_completedCondition.notify_all();
+
+	return result;
+}
+
+bool TaskBase::notifyDependencyCompleted() noexcept
+{
+	return _pendingDependenciesCount.fetch_sub(1u) == 1u;
+}
+
+bool TaskBase::isCompleted() const noexcept
+{
+	std::lock_guard lock(_continuationsMutex);
+
+	return _isCompleted;
+}
+
+void TaskBase::waitCompletion() const noexcept
+{
+	std::unique_lock lock(_continuationsMutex);
+
+	_completedCondition.wait(lock, [this]() { return _isCompleted; });
+}
+
+bool TaskBase::isReadyToExecute() const noexcept
+{
+	return _pendingDependenciesCount.load() == 0u;
+}
+
 std::string const& TaskBase::getName() const noexcept
 {
 	return _name;
-}
\ No newline at end of file
+}
@@ -0,0 +1,40 @@
+#include "Kodgen/Threading/TaskDeque.h"
+
+using namespace kodgen;
+
+void TaskDeque::push(std::shared_ptr<TaskBase>&& task) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_tasks.emplace_back(std::forward<std::shared_ptr<TaskBase>>(task));
+}
+
+std::shared_ptr<TaskBase> TaskDeque::pop() noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	if (_tasks.empty())
+	{
+		return nullptr;
+	}
+
+	std::shared_ptr<TaskBase> result = std::move(_tasks.back());
+	_tasks.pop_back();
+
+	return result;
+}
+
+std::shared_ptr<TaskBase> TaskDeque::steal() noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	if (_tasks.empty())
+	{
+		return nullptr;
+	}
+
+	std::shared_ptr<TaskBase> result = std::move(_tasks.front());
+	_tasks.pop_front();
+
+	return result;
+}
@@ -4,7 +4,13 @@
 
 using namespace kodgen;
 
+thread_local ThreadPool*	ThreadPool::_currentThreadPool	= nullptr;
+thread_local uint32			ThreadPool::_currentWorkerIndex	= 0u;
+
 ThreadPool::ThreadPool(uint32 threadCount, ETerminationMode	terminationMode) noexcept:
+	_taskDeques(threadCount),
+	_queuedTasksCount{0u},
+	_nextDequeIndex{0u},
 	_destructorCalled{false},
 	_workingWorkers{threadCount},
 	terminationMode{terminationMode}
@@ -16,7 +22,7 @@ ThreadPool::ThreadPool(uint32 threadCount, ETerminationMode	terminationMode) noe
 
 	for (uint32 i = 0u; i < threadCount; i++)
 	{
-		_workers.emplace_back(std::thread(std::bind(&ThreadPool::workerRoutine, this)));
+		_workers.emplace_back(std::thread(std::bind(&ThreadPool::workerRoutine, this, i)));
 	}
 }
 
@@ -37,60 +43,136 @@ ThreadPool::~ThreadPool() noexcept
 			worker.join();
 		}
 	}
+
+	//Tasks left in the deques will never be executed (ETerminationMode::FinishCurrent)
+	for (TaskDeque& deque : _taskDeques)
+	{
+		for (std::shared_ptr<TaskBase> task = deque.pop(); task != nullptr; task = deque.pop())
+		{
+			releaseContinuations(*task);
+		}
+	}
 }
 
-void ThreadPool::workerRoutine() noexcept
+void ThreadPool::workerRoutine(uint32 workerIndex) noexcept
 {
-	std::unique_lock lock(_taskMutex);
+	_currentThreadPool	= this;
+	_currentWorkerIndex	= workerIndex;
+
+	std::unique_lock lock(_taskMutex, std::defer_lock);
 
 	while (shouldKeepRunning())
 	{
-		if (!_tasks.empty() && _isRunning)
+		if (_isRunning && _queuedTasksCount.load() != 0u)
 		{
-			//We own the mutex before grabbing a task
-			std::shared_ptr<TaskBase> task = getTask();
+			//Tasks are grabbed without locking _taskMutex so that workers don't serialize on a single lock
+			std::shared_ptr<TaskBase> task = getTask(workerIndex);
 
 			if (task != nullptr)
 			{
-				//Release the mutex before executing the task to allow other workers to grab tasks during execution
-				lock.unlock();
-
 				task->execute();
 
-				lock.lock();
+				completeTask(*task);
+
+				continue;
 			}
 		}
 
-		if (!_destructorCalled && (_tasks.empty() || !_isRunning))
+		lock.lock();
+
+		if (!_destructorCalled && (_queuedTasksCount.load() == 0u || !_isRunning))
 		{
 			//A worker is about to sleep, decrement working workers count
-			_workingWorkers.fetch_sub(1u);
+			if (_workingWorkers.fetch_sub(1u) == 1u)
+			{
+				//Last working worker, wake up the threads joining workers
+				_idleCondition.notify_all();
+			}
 
 			_taskCondition.wait(lock);
 
 			//A worker is resuming its activity, increment working workers count
 			_workingWorkers.fetch_add(1u);
 		}
+
+		lock.unlock();
+	}
+
+	_currentThreadPool = nullptr;
+}
+
+std::shared_ptr<TaskBase> ThreadPool::getTask(uint32 workerIndex) noexcept
+{
+	//Check the worker own deque first
+	std::shared_ptr<TaskBase> result = _taskDeques[workerIndex].pop();
+
+	//Then try to steal from other workers, starting from the next one to spread contention
+	for (size_t i = 1u; result == nullptr && i < _taskDeques.size(); i++)
+	{
+		result = _taskDeques[(workerIndex + i) % _taskDeques.size()].steal();
 	}
+
+	if (result != nullptr)
+	{
+		_queuedTasksCount.fetch_sub(1u);
+	}
+
+	return result;
+}
+
+void ThreadPool::pushTask(std::shared_ptr<TaskBase>&& task) noexcept
+{
+	uint32 dequeIndex = (_currentThreadPool == this) ?	_currentWorkerIndex :
+														_nextDequeIndex.fetch_add(1u) % static_cast<uint32>(_taskDeques.size());
+
+	//Count the task before it can be popped, otherwise a worker could decrement the count first and wrap it around
+	_queuedTasksCount.fetch_add(1u);
+	_taskDeques[dequeIndex].push(std::forward<std::shared_ptr<TaskBase>>(task));
+
+	//Lock the mutex to make sure no worker is between its sleep condition check and its wait call, otherwise the notification would be lost
+	_taskMutex.lock();
+	_taskMutex.unlock();
+
+	_taskCondition.notify_one();
 }
 
-std::shared_ptr<TaskBase> ThreadPool::getTask() noexcept
+void ThreadPool::scheduleTask(std::shared_ptr<TaskBase>&& task) noexcept
 {
-	//Iterate over all tasks
-	for (decltype(_tasks)::iterator it = _tasks.begin(); it != _tasks.end(); it++)
+	//Hold an extra pending dependency while registering so that the task can't be pushed by a completing dependency in the meantime
+	task->_pendingDependenciesCount.fetch_add(1u);
+
+	for (std::shared_ptr<TaskBase> const& dependency : task->dependencies)
 	{
-		//Get the first ready task
-		if ((*it)->isReadyToExecute())
+		if (!dependency->addContinuation(task))
 		{
-			std::shared_ptr<TaskBase> result = std::move(*it);
+			//The dependency has already completed
+			task->notifyDependencyCompleted();
+		}
+	}
 
-			_tasks.erase(it);
+	if (task->notifyDependencyCompleted())
+	{
+		pushTask(std::forward<std::shared_ptr<TaskBase>>(task));
+	}
+}
 
-			return result;
+void ThreadPool::completeTask(TaskBase& task) noexcept
+{
+	for (std::shared_ptr<TaskBase>& continuation : task.complete())
+	{
+		if (continuation->notifyDependencyCompleted())
+		{
+			pushTask(std::move(continuation));
 		}
 	}
+}
 
-	return nullptr;
+void ThreadPool::releaseContinuations(TaskBase& task) noexcept
+{
+	for (std::shared_ptr<TaskBase>& continuation : task.complete())
+	{
+		releaseContinuations(*continuation);
+	}
 }
 
 void ThreadPool::joinWorkers() noexcept
@@ -115,19 +197,59 @@ void ThreadPool::joinWorkers() noexcept
 	}
 	else
 	{
-		lock.unlock();
+		//Sleep until all workers are blocked on the _taskCondition
+		_idleCondition.wait(lock, [this]()
+							{
+								return _workingWorkers.load() == 0u && (!_isRunning || _queuedTasksCount.load() == 0u);
+							});
+	}
+}
 
-		//Just wait for all workers to be blocked on the _taskCondition
-		while (_workingWorkers.load() != 0u || (_isRunning && !_tasks.empty()))
+void ThreadPool::waitFor(std::shared_ptr<TaskBase> const& task) noexcept
+{
+	assert(task != nullptr);
+
+	if (_currentThreadPool == this)
+	{
+		//Blocking a worker could starve the awaited task or its dependencies, so execute other tasks in the meantime
+		while (!task->isCompleted())
 		{
-			std::this_thread::yield();
+			std::shared_ptr<TaskBase> otherTask = _isRunning ? getTask(_currentWorkerIndex) : nullptr;
+
+			if (otherTask != nullptr)
+			{
+				otherTask->execute();
+
+				completeTask(*otherTask);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
 		}
 	}
+	else
+	{
+		task->waitCompletion();
+	}
+}
+
+uint32 ThreadPool::getCurrentWorkerIndex() const noexcept
+{
+	//If you assert here, the method has not been called from one of this pool workers
+	assert(_currentThreadPool == this);
+
+	return _currentWorkerIndex;
+}
+
+uint32 ThreadPool::getWorkerCount() const noexcept
+{
+	return static_cast<uint32>(_workers.size());
 }
 
 bool ThreadPool::shouldKeepRunning() const noexcept
 {
-	return	!_destructorCalled || (terminationMode == ETerminationMode::FinishAll && _tasks.size() != 0u);
+	return	!_destructorCalled || (terminationMode == ETerminationMode::FinishAll && _queuedTasksCount.load() != 0u);
 }
 
 void ThreadPool::setIsRunning(bool isRunning) noexcept
@@ -144,5 +266,10 @@ void ThreadPool::setIsRunning(bool isRunning) noexcept
 		{
 			_taskCondition.notify_all();
 		}
+		else
+		{
+			//Queued tasks are not waited anymore by joinWorkers
+			_idleCondition.notify_all();
+		}
 	}
-}
\ No newline at end of file
+}
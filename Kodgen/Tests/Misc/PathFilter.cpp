@@ -0,0 +1,117 @@
+#include <Kodgen/Misc/PathFilter.h>
+
+#include "TestHelpers.h"
+
+using namespace kodgen;
+using namespace kodgen::tests;
+
+//Checked paths must be absolute and normalized
+static fs::path const root = fs::absolute("PathFilterRoot").lexically_normal();
+
+static void testPlainPaths()
+{
+	PathFilter filter;
+
+	filter.addIgnoredDirectory(root / "Ignored");
+	filter.addIgnoredFile(root / "Source" / "Ignored.h");
+
+	check(filter.isIgnoredDirectory(root / "Ignored"), "Plain: ignored directory");
+	check(filter.isIgnoredDirectory(root / "Ignored" / "Sub"), "Plain: child of an ignored directory");
+	check(filter.isIgnoredFile(root / "Ignored" / "File.h"), "Plain: file in an ignored directory");
+	check(!filter.isIgnoredDirectory(root / "IgnoredNot"), "Plain: components are compared whole");
+	check(!filter.isIgnoredDirectory(root), "Plain: parent of an ignored directory");
+
+	check(filter.isIgnoredFile(root / "Source" / "Ignored.h"), "Plain: ignored file");
+	check(!filter.isIgnoredDirectory(root / "Source" / "Ignored.h"), "Plain: an ignored file is not an ignored directory");
+	check(!filter.isIgnoredFile(root / "Source" / "Ignored.h" / "File.h"), "Plain: an ignored file does not ignore paths below it");
+	check(!filter.isIgnoredFile(root / "Source" / "Other.h"), "Plain: sibling of an ignored file");
+
+	filter.clear();
+
+	check(!filter.isIgnoredDirectory(root / "Ignored"), "Plain: clear removes ignored directories");
+	check(!filter.isIgnoredFile(root / "Source" / "Ignored.h"), "Plain: clear removes ignored files");
+}
+
+static void testWildcards()
+{
+	PathFilter filter;
+
+	filter.addIgnoredFile(root / "*.generated.h");
+	filter.addIgnoredFile(root / "File?.h");
+
+	check(filter.isIgnoredFile(root / "A.generated.h"), "*: matches any characters");
+	check(filter.isIgnoredFile(root / ".generated.h"), "*: matches an empty string");
+	check(!filter.isIgnoredFile(root / "A.generated.hpp"), "*: the rest of the pattern must match");
+	check(!filter.isIgnoredFile(root / "Sub" / "A.generated.h"), "*: does not match across components");
+
+	check(filter.isIgnoredFile(root / "File1.h"), "?: matches a single character");
+	check(!filter.isIgnoredFile(root / "File.h"), "?: does not match an empty string");
+	check(!filter.isIgnoredFile(root / "File12.h"), "?: does not match two characters");
+}
+
+static void testDoubleStar()
+{
+	PathFilter filter;
+
+	filter.addIgnoredDirectory(root / "**" / "Generated");
+	filter.addIgnoredFile(root / "Source" / "**");
+
+	check(filter.isIgnoredDirectory(root / "Generated"), "**: matches no component");
+	check(filter.isIgnoredDirectory(root / "A" / "B" / "Generated"), "**: matches several components");
+	check(filter.isIgnoredDirectory(root / "A" / "Generated" / "Sub"), "**: child of a matched directory");
+	check(filter.isIgnoredFile(root / "A" / "Generated" / "File.h"), "**: file in a matched directory");
+	check(!filter.isIgnoredDirectory(root / "A" / "NotGenerated"), "**: the following component must match");
+
+	check(filter.isIgnoredFile(root / "Source" / "File.h"), "Trailing **: file right below");
+	check(filter.isIgnoredFile(root / "Source" / "A" / "B" / "File.h"), "Trailing **: file several levels below");
+	check(!filter.isIgnoredFile(root / "Other" / "File.h"), "Trailing **: file outside of the prefix");
+	check(!filter.isIgnoredDirectory(root / "Source" / "A"), "Trailing **: a file pattern does not ignore directories");
+}
+
+static void testRelativePatterns()
+{
+	PathFilter filter;
+
+	filter.addIgnoredDirectory("Generated*");
+	filter.addIgnoredDirectory("./**/Cache");
+	filter.addIgnoredFile("Sub/../*.tmp");
+
+	check(filter.isIgnoredDirectory(root / "Generated"), "Relative: matches right below the root");
+	check(filter.isIgnoredDirectory(root / "A" / "B" / "GeneratedFiles"), "Relative: matches anywhere");
+	check(filter.isIgnoredDirectory(root / "A" / "Cache"), "Relative: a leading . is normalized");
+	check(filter.isIgnoredFile(root / "A" / "File.tmp"), "Relative: .. is normalized");
+	check(!filter.isIgnoredFile(root / "A" / "File.h"), "Relative: non matching file");
+
+	filter.clear();
+	filter.addIgnoredDirectory(root / "A" / "Gen*");
+
+	check(filter.isIgnoredDirectory(root / "A" / "Generated"), "Absolute: matches at its location");
+	check(!filter.isIgnoredDirectory(root / "B" / "A" / "Generated"), "Absolute: does not match anywhere else");
+}
+
+static void testFileAndDirectoryPatterns()
+{
+	PathFilter filter;
+
+	filter.addIgnoredFile("*.h");
+	filter.addIgnoredDirectory("*.d");
+
+	check(filter.isIgnoredFile(root / "File.h"), "File pattern: matches files");
+	check(!filter.isIgnoredDirectory(root / "Directory.h"), "File pattern: does not match directories");
+	check(!filter.isIgnoredFile(root / "Directory.h" / "File.cpp"), "File pattern: does not ignore the content of a matching directory");
+
+	check(filter.isIgnoredDirectory(root / "Directory.d"), "Directory pattern: matches directories");
+	check(filter.isIgnoredFile(root / "Directory.d" / "File.cpp"), "Directory pattern: ignores the content of matching directories");
+	check(!filter.isIgnoredFile(root / "File.d"), "Directory pattern: does not match files");
+}
+
+int main()
+{
+	testPlainPaths();
+	testWildcards();
+	testDoubleStar();
+	testRelativePatterns();
+	testFileAndDirectoryPatterns();
+
+	return getExitCode("All path filter tests passed.");
+}
@@ -0,0 +1,379 @@
+#include <string>
+#include <string_view>
+#include <cstring>	//std::memcpy
+
+#include <Kodgen/Parsing/ParsingResultWriter.h>
+#include <Kodgen/Parsing/ParsingResultReader.h>
+#include <Kodgen/Parsing/ParsedFileView.h>
+#include <Kodgen/InfoStructures/FieldInfo.h>
+#include <Kodgen/InfoStructures/MethodInfo.h>
+
+#include "TestHelpers.h"
+
+using namespace kodgen;
+using namespace kodgen::tests;
+
+static std::string serialize(FileParsingResult const& result)
+{
+	ParsingResultWriter writer;
+	writer.write(result);
+
+	return writer.getData();
+}
+
+//Build a parsing result using every kind of entity, nesting and property argument
+static void fillParsingResult(FileParsingResult& out_result)
+{
+	out_result.parsedFile = "/project/Include/Entities.h";
+	out_result.includedFiles.emplace_back("/project/Include/Base.h");
+	out_result.includedFiles.emplace_back("/usr/include/c++/vector");
+
+	NamespaceInfo& namespace_ = out_result.namespaces.emplace_back();
+	namespace_.name	= "ns";
+	namespace_.id	= "c:@N@ns";
+
+	Property& property = namespace_.properties.emplace_back();
+	property.name		= "Prop";
+	property.arguments	= { "(1, (true, \"x\"))", "T", "N" };
+
+	PropertyArgument& list = property.typedArguments.emplace_back();
+	list.type = EPropertyArgumentType::List;
+	list.listValue.emplace_back().type = EPropertyArgumentType::Integer;
+	list.listValue.back().integerValue = INT64_MIN;
+
+	PropertyArgument& nestedList = list.listValue.emplace_back();
+	nestedList.type = EPropertyArgumentType::List;
+	nestedList.listValue.emplace_back().type = EPropertyArgumentType::Boolean;
+	nestedList.listValue.back().booleanValue = true;
+	nestedList.listValue.emplace_back().type = EPropertyArgumentType::String;
+	nestedList.listValue.back().stringValue = "x";
+
+	property.typedArguments.emplace_back().type = EPropertyArgumentType::Identifier;
+	property.typedArguments.back().stringValue = "T";
+	property.typedArguments.emplace_back().type = EPropertyArgumentType::FloatingPoint;
+	property.typedArguments.back().floatingPointValue = 1.5;
+
+	StructClassInfo& class_ = namespace_.classes.emplace_back();
+	class_.entityType			= EEntityType::Class;
+	class_.name					= "C";
+	class_.id					= "c:@N@ns@C";
+	class_.qualifiers.isFinal	= true;
+	class_.parents.emplace_back(EAccessSpecifier::Public, TypeInfo());
+	class_.parents.back().type.sizeInBytes = 8u;
+
+	FieldInfo& field = class_.fields.emplace_back();
+	field.name			= "field";
+	field.isMutable		= true;
+	field.memoryOffset	= 8;
+	field.type.typeParts.push_back(TypePart{ 0u, ETypeDescriptor::Ptr, 0u });
+	field.type.typeParts.push_back(TypePart{ 0u, ETypeDescriptor::Value, 0u });
+	field.type.sizeInBytes = 8u;
+
+	MethodInfo& method = class_.methods.emplace_back();
+	method.name			= "method";
+	method.prototype	= "void (int) const";
+	method.isConst		= true;
+	method.isVirtual	= true;
+	method.parameters.push_back(FunctionParamInfo{ TypeInfo(), "param" });
+
+	StructClassInfo nestedStruct;
+	nestedStruct.entityType	= EEntityType::Struct;
+	nestedStruct.name		= "Nested";
+
+	StructClassInfo deeplyNestedClass;
+	deeplyNestedClass.entityType = EEntityType::Class;
+	deeplyNestedClass.name		 = "DeeplyNested";
+	deeplyNestedClass.fields.emplace_back().name = "deepField";
+
+	nestedStruct.nestedClasses.push_back(std::make_shared<NestedStructClassInfo>(std::move(deeplyNestedClass), EAccessSpecifier::Protected));
+	class_.nestedStructs.push_back(std::make_shared<NestedStructClassInfo>(std::move(nestedStruct), EAccessSpecifier::Private));
+
+	EnumInfo enum_;
+	enum_.entityType = EEntityType::Enum;
+	enum_.name		 = "E";
+
+	EnumValueInfo& enumValue = enum_.enumValues.emplace_back();
+	enumValue.entityType	= EEntityType::EnumValue;
+	enumValue.name			= "Value";
+	enumValue.value			= -3;
+
+	class_.nestedEnums.emplace_back(std::move(enum_), EAccessSpecifier::Protected);
+
+	StructClassInfo& struct_ = out_result.structs.emplace_back();
+	struct_.entityType	= EEntityType::Struct;
+	struct_.name		= "S";
+
+	FunctionInfo& function = out_result.functions.emplace_back();
+	function.name		= "function";
+	function.prototype	= "ns::C (int)";
+	function.isInline	= true;
+
+	out_result.variables.emplace_back().name = "variable";
+
+	out_result.structClassTree.addInheritanceLink("ns::C", "Base", EAccessSpecifier::Public);
+	out_result.structClassTree.addInheritanceLink("Base", "Root", EAccessSpecifier::Protected);
+	out_result.structClassTree.addInheritanceLink("S", "Root", EAccessSpecifier::Private);
+	out_result.structClassTree.build();
+}
+
+//Get the header of serialized data
+static ParsedFileFormat::Header const& getHeader(std::string const& data)
+{
+	return *reinterpret_cast<ParsedFileFormat::Header const*>(data.data());
+}
+
+//Get the StringOffsets section of serialized data
+static uint32 const* getStringOffsets(std::string const& data)
+{
+	return reinterpret_cast<uint32 const*>(data.data() + getHeader(data).sections[static_cast<uint32>(ParsedFileFormat::ESection::StringOffsets)].offset);
+}
+
+//Get the number of strings of serialized data
+static uint32 getStringCount(std::string const& data)
+{
+	return static_cast<uint32>(getHeader(data).sections[static_cast<uint32>(ParsedFileFormat::ESection::StringOffsets)].size / sizeof(uint32)) - 1u;
+}
+
+//Find the index of a string in the string table of serialized data
+static uint32 findString(std::string const& data, std::string_view string)
+{
+	ParsedFileView view(data);
+
+	for (uint32 i = 0u; i < getStringCount(data); i++)
+	{
+		if (view.getString(i) == string)
+		{
+			return i;
+		}
+	}
+
+	return ParsedFileFormat::invalidIndex;
+}
+
+/**
+*	Template parameters can only be filled from libclang or from serialized data,
+*	so they are added to the serialized data directly: the return type of the function gets
+*	a type template parameter T (typed as the variable type) and a non-type template parameter N.
+*/
+static std::string addTemplateParameters(std::string data)
+{
+	ParsedFileView view(data);
+
+	if (!view.isValid())
+	{
+		return std::string();
+	}
+
+	uint32 functionReturnType	= ParsedFileFormat::invalidIndex;
+	uint32 variableType			= ParsedFileFormat::invalidIndex;
+
+	for (ParsedFileFormat::EntityRecord const& entity : view.getEntities())
+	{
+		if (entity.entityType == EEntityType::Function)
+		{
+			functionReturnType = entity.type;
+		}
+		else if (entity.entityType == EEntityType::Variable)
+		{
+			variableType = entity.type;
+		}
+	}
+
+	ParsedFileFormat::TemplateParamRecord templateParams[2] = {};
+
+	templateParams[0].name	= findString(data, "T");
+	templateParams[0].type	= variableType;
+	templateParams[0].kind	= ETemplateParameterKind::TypeTemplateParameter;
+	templateParams[1].name	= findString(data, "N");
+	templateParams[1].type	= ParsedFileFormat::invalidIndex;
+	templateParams[1].kind	= ETemplateParameterKind::NonTypeTemplateParameter;
+
+	size_t returnTypeOffset = reinterpret_cast<char const*>(&view.getTypes()[functionReturnType]) - data.data();
+
+	//Append the TemplateParams section at the end of the data and make the header point to it
+	data.resize((data.size() + ParsedFileFormat::sectionAlignment - 1u) / ParsedFileFormat::sectionAlignment * ParsedFileFormat::sectionAlignment, '\0');
+
+	ParsedFileFormat::Header header;
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	header.sections[static_cast<uint32>(ParsedFileFormat::ESection::TemplateParams)] = { data.size(), sizeof(templateParams) };
+	std::memcpy(data.data(), &header, sizeof(header));
+	data.append(reinterpret_cast<char const*>(templateParams), sizeof(templateParams));
+
+	ParsedFileFormat::TypeRecord returnType;
+	std::memcpy(&returnType, data.data() + returnTypeOffset, sizeof(returnType));
+
+	returnType.firstTemplateParam	= 0u;
+	returnType.templateParamCount	= 2u;
+	std::memcpy(data.data() + returnTypeOffset, &returnType, sizeof(returnType));
+
+	return data;
+}
+
+//A parsing result read back from its serialized data is serialized to the same data, and its pointers are rebuilt
+static void testRoundTrip()
+{
+	FileParsingResult result;
+	fillParsingResult(result);
+
+	std::string			data = serialize(result);
+	FileParsingResult	readResult;
+
+	check(ParsedFileView(data).isValid(), "Round trip: serialized data is valid");
+	check(ParsingResultReader(data).read(readResult), "Round trip: serialized data is read");
+	check(serialize(readResult) == data, "Round trip: read result is serialized to the same data");
+
+	if (readResult.namespaces.size() != 1u || readResult.namespaces[0].classes.size() != 1u || readResult.functions.size() != 1u)
+	{
+		check(false, "Round trip: entities are read");
+		return;
+	}
+
+	NamespaceInfo const&	namespace_	= readResult.namespaces[0];
+	StructClassInfo const&	class_		= namespace_.classes[0];
+
+	check(readResult.parsedFile == result.parsedFile && readResult.includedFiles == result.includedFiles, "Round trip: parsed and included files");
+	check(class_.name == "C" && class_.id == "c:@N@ns@C" && class_.qualifiers.isFinal && class_.parents.size() == 1u, "Round trip: class");
+	check(class_.outerEntity == &namespace_, "Round trip: class outer entity");
+	check(class_.fields.size() == 1u && class_.fields[0].isMutable && class_.fields[0].memoryOffset == 8 &&
+		  class_.fields[0].type.typeParts.size() == 2u && class_.fields[0].outerEntity == &class_, "Round trip: field");
+	check(class_.methods.size() == 1u && class_.methods[0].isConst && class_.methods[0].isVirtual && !class_.methods[0].isFinal &&
+		  class_.methods[0].parameters.size() == 1u && class_.methods[0].parameters[0].name == "param", "Round trip: method");
+	check(class_.nestedEnums.size() == 1u && class_.nestedEnums[0].accessSpecifier == EAccessSpecifier::Protected &&
+		  class_.nestedEnums[0].enumValues.size() == 1u && class_.nestedEnums[0].enumValues[0].value == -3 &&
+		  class_.nestedEnums[0].enumValues[0].outerEntity == &class_.nestedEnums[0], "Round trip: nested enum");
+
+	if (class_.nestedStructs.size() == 1u && class_.nestedStructs[0]->nestedClasses.size() == 1u)
+	{
+		NestedStructClassInfo const& nestedStruct		= *class_.nestedStructs[0];
+		NestedStructClassInfo const& deeplyNestedClass	= *nestedStruct.nestedClasses[0];
+
+		check(nestedStruct.accessSpecifier == EAccessSpecifier::Private && nestedStruct.outerEntity == &class_, "Round trip: nested struct");
+		check(deeplyNestedClass.name == "DeeplyNested" && deeplyNestedClass.accessSpecifier == EAccessSpecifier::Protected &&
+			  deeplyNestedClass.outerEntity == &nestedStruct && deeplyNestedClass.fields.size() == 1u &&
+			  deeplyNestedClass.fields[0].outerEntity == &deeplyNestedClass, "Round trip: class nested in a nested struct");
+	}
+	else
+	{
+		check(false, "Round trip: nested structs/classes are read");
+	}
+
+	std::vector<PropertyArgument> const& typedArguments = namespace_.properties[0].typedArguments;
+
+	check(namespace_.properties.size() == 1u && namespace_.properties[0].arguments == result.namespaces[0].properties[0].arguments, "Round trip: property arguments");
+	check(typedArguments.size() == 3u && typedArguments[0].type == EPropertyArgumentType::List && typedArguments[0].listValue.size() == 2u &&
+		  typedArguments[0].listValue[0].integerValue == INT64_MIN && typedArguments[0].listValue[1].listValue.size() == 2u &&
+		  typedArguments[0].listValue[1].listValue[0].booleanValue && typedArguments[0].listValue[1].listValue[1].stringValue == "x" &&
+		  typedArguments[1].type == EPropertyArgumentType::Identifier && typedArguments[1].stringValue == "T" &&
+		  typedArguments[2].floatingPointValue == 1.5, "Round trip: nested typed list arguments");
+
+	EAccessSpecifier inheritanceAccess = EAccessSpecifier::Invalid;
+
+	check(readResult.structClassTree.isBaseOf("Root", "ns::C", &inheritanceAccess) && inheritanceAccess == EAccessSpecifier::Protected, "Round trip: indirect inheritance");
+	check(readResult.structClassTree.isBaseOf("Root", "S", &inheritanceAccess) && inheritanceAccess == EAccessSpecifier::Private, "Round trip: direct inheritance");
+	check(!readResult.structClassTree.isBaseOf("S", "ns::C"), "Round trip: unrelated structs/classes");
+}
+
+static void testTemplateRoundTrip()
+{
+	FileParsingResult result;
+	fillParsingResult(result);
+
+	std::string			data = addTemplateParameters(serialize(result));
+	FileParsingResult	readResult;
+
+	check(ParsedFileView(data).isValid(), "Templates: data with template parameters is valid");
+
+	if (!ParsingResultReader(data).read(readResult) || readResult.functions.size() != 1u)
+	{
+		check(false, "Templates: data with template parameters is read");
+		return;
+	}
+
+	std::vector<TemplateParamInfo> const& templateParams = readResult.functions[0].returnType.getTemplateParameters();
+
+	check(templateParams.size() == 2u && templateParams[0].name == "T" && templateParams[0].kind == ETemplateParameterKind::TypeTemplateParameter &&
+		  templateParams[0].type != nullptr && templateParams[1].name == "N" && templateParams[1].kind == ETemplateParameterKind::NonTypeTemplateParameter &&
+		  templateParams[1].type == nullptr, "Templates: template parameters are read");
+
+	//The writer stores template parameter types right after their owner, so compare a second round trip
+	std::string			rewrittenData = serialize(readResult);
+	FileParsingResult	rereadResult;
+
+	check(ParsingResultReader(rewrittenData).read(rereadResult) && serialize(rereadResult) == rewrittenData, "Templates: template parameters round trip");
+	check(rereadResult.functions.size() == 1u && rereadResult.functions[0].returnType.getTemplateParameters().size() == 2u, "Templates: template parameters are written");
+}
+
+//Apply a modification to a record of valid data and check that the result is rejected
+template <typename RecordType, typename Modifier>
+static bool isRejected(std::string const& data, RecordType const& record, Modifier modifier)
+{
+	std::string	modifiedData	= data;
+	size_t		offset			= reinterpret_cast<char const*>(&record) - data.data();
+	RecordType	modifiedRecord;
+
+	std::memcpy(&modifiedRecord, modifiedData.data() + offset, sizeof(RecordType));
+	modifier(modifiedRecord);
+	std::memcpy(modifiedData.data() + offset, &modifiedRecord, sizeof(RecordType));
+
+	FileParsingResult result;
+
+	return !ParsedFileView(modifiedData).isValid() && !ParsingResultReader(modifiedData).read(result);
+}
+
+static void testCorruptedData()
+{
+	FileParsingResult result;
+	fillParsingResult(result);
+
+	std::string		data = addTemplateParameters(serialize(result));
+	ParsedFileView	view(data);
+	bool			isTruncationRejected = true;
+
+	for (size_t size = 0u; size < data.size(); size++)
+	{
+		FileParsingResult truncatedResult;
+
+		if (ParsedFileView(std::string_view(data).substr(0u, size)).isValid() || ParsingResultReader(std::string_view(data).substr(0u, size)).read(truncatedResult))
+		{
+			isTruncationRejected = false;
+		}
+	}
+
+	check(isTruncationRejected, "Corrupted: truncated data is rejected");
+
+	ParsedFileFormat::Header const&	header		= getHeader(data);
+	uint32							stringCount	= getStringCount(data);
+
+	check(isRejected(data, header, [](ParsedFileFormat::Header& h) { h.magic[0] = 'X'; }), "Corrupted: wrong magic");
+	check(isRejected(data, header, [](ParsedFileFormat::Header& h) { h.version++; }), "Corrupted: other format version");
+	check(isRejected(data, header, [&](ParsedFileFormat::Header& h) { h.parsedFile = stringCount; }), "Corrupted: parsed file string out of bounds");
+	check(isRejected(data, header, [&](ParsedFileFormat::Header& h) { h.sections[static_cast<uint32>(ParsedFileFormat::ESection::Entities)].offset = data.size(); }), "Corrupted: section out of bounds");
+	check(isRejected(data, header, [](ParsedFileFormat::Header& h) { h.sections[static_cast<uint32>(ParsedFileFormat::ESection::Types)].offset += 4u; }), "Corrupted: misaligned section");
+	check(isRejected(data, header, [](ParsedFileFormat::Header& h) { h.sections[static_cast<uint32>(ParsedFileFormat::ESection::StringData)].size--; }), "Corrupted: string data size");
+
+	ParsedFileFormat::EntityRecord const& lastEntity = view.getEntities()[view.getEntities().size() - 1u];
+
+	check(isRejected(data, view.getEntities()[0], [&](ParsedFileFormat::EntityRecord& e) { e.name = stringCount; }), "Corrupted: entity name out of bounds");
+	check(isRejected(data, view.getEntities()[0], [&](ParsedFileFormat::EntityRecord& e) { e.subtreeEnd = view.getEntities().size() + 1u; }), "Corrupted: subtree end out of bounds");
+	check(isRejected(data, view.getEntities()[1], [](ParsedFileFormat::EntityRecord& e) { e.subtreeEnd = 1u; }), "Corrupted: empty subtree");
+	check(isRejected(data, view.getEntities()[1], [](ParsedFileFormat::EntityRecord& e) { e.outerEntity = 1u; }), "Corrupted: entity nested in itself");
+	check(isRejected(data, lastEntity, [&](ParsedFileFormat::EntityRecord& e) { e.firstProperty = view.getProperties().size(); e.propertyCount = 1u; }), "Corrupted: property range out of bounds");
+	check(isRejected(data, lastEntity, [](ParsedFileFormat::EntityRecord& e) { e.firstProperty = 0u; e.propertyCount = ParsedFileFormat::invalidIndex; }), "Corrupted: overflowing property range");
+	check(isRejected(data, lastEntity, [&](ParsedFileFormat::EntityRecord& e) { e.type = view.getTypes().size(); }), "Corrupted: entity type out of bounds");
+
+	check(isRejected(data, getStringOffsets(data)[1], [](uint32& offset) { offset = ParsedFileFormat::invalidIndex; }), "Corrupted: decreasing string offsets");
+	check(isRejected(data, view.getTemplateParams()[0], [](ParsedFileFormat::TemplateParamRecord& t) { t.type = 0u; }), "Corrupted: cyclic template parameter type");
+	check(isRejected(data, view.getTypedArguments()[1], [](ParsedFileFormat::TypedArgumentRecord& a) { a.listElementCount = 1u; a.firstListElement = 0u; }), "Corrupted: list element stored before its list");
+	check(isRejected(data, view.getParents()[0], [&](ParsedFileFormat::ParentRecord& p) { p.type = view.getTypes().size(); }), "Corrupted: parent type out of bounds");
+	check(isRejected(data, view.getStructClassTreeLinks()[0], [&](ParsedFileFormat::StructClassTreeLinkRecord& l) { l.parent = view.getStructClassTreeNodes().size(); }), "Corrupted: struct/class tree node out of bounds");
+}
+
+int main()
+{
+	testRoundTrip();
+	testTemplateRoundTrip();
+	testCorruptedData();
+
+	return getExitCode("All parsing result serialization tests passed.");
+}
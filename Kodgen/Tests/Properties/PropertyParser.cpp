@@ -0,0 +1,152 @@
+#include <string>
+#include <vector>
+#include <cstdint>	//INT64_MIN, INT64_MAX
+
+#include <Kodgen/Parsing/PropertyParser.h>
+#include <Kodgen/Properties/PropertyParsingSettings.h>
+
+#include "TestHelpers.h"
+
+using namespace kodgen;
+using namespace kodgen::tests;
+
+static opt::optional<std::vector<Property>> parseClassProperties(std::string_view annotateMessage, bool shouldParseTypedArguments)
+{
+	PropertyParsingSettings settings;
+	settings.shouldParseTypedArguments = shouldParseTypedArguments;
+
+	PropertyParser parser;
+	parser.setup(settings);
+
+	return parser.getClassProperties(annotateMessage);
+}
+
+//Parse a single property with a single argument and return its typed value
+static PropertyArgument parseTypedArgument(std::string const& argument)
+{
+	opt::optional<std::vector<Property>> properties = parseClassProperties("KGC:P(" + argument + ")", true);
+
+	if (!properties.has_value() || properties->size() != 1u || properties->front().typedArguments.size() != 1u)
+	{
+		return PropertyArgument{};
+	}
+
+	return properties->front().typedArguments.front();
+}
+
+//Without typed arguments, arguments are split on the first separator or end encloser, ignoring quotes
+static void testUntypedTokenizer()
+{
+	opt::optional<std::vector<Property>> properties = parseClassProperties("KGC:A, D(x\"y, z)", false);
+
+	check(properties.has_value() && properties->size() == 2u, "Untyped: two properties are found");
+
+	if (properties.has_value() && properties->size() == 2u)
+	{
+		check((*properties)[0].name == "A" && (*properties)[0].arguments.empty(), "Untyped: property without arguments");
+		check((*properties)[1].name == "D", "Untyped: property name");
+		check((*properties)[1].arguments == std::vector<std::string>{ "x\"y", "z" }, "Untyped: an unbalanced quote does not swallow the separator");
+		check((*properties)[1].typedArguments.empty(), "Untyped: typed arguments are not filled");
+	}
+
+	properties = parseClassProperties("KGC:P(\"a,b\")", false);
+
+	check(properties.has_value() && properties->size() == 1u &&
+		  properties->front().arguments == std::vector<std::string>{ "\"a", "b\"" }, "Untyped: separators inside quotes still split arguments");
+
+	properties = parseClassProperties("KGC:P()", false);
+
+	check(properties.has_value() && properties->size() == 1u && properties->front().arguments.empty(), "Untyped: empty arguments");
+
+	check(!parseClassProperties("KGC:P(a, b", false).has_value(), "Untyped: missing end encloser is an error");
+	check(!parseClassProperties("KGC:P(a) Q", false).has_value(), "Untyped: missing property separator is an error");
+}
+
+//With typed arguments, string literals and nested enclosers are kept whole
+static void testTypedTokenizer()
+{
+	opt::optional<std::vector<Property>> properties = parseClassProperties("KGC:P(\"a,b\", (1, (2, 3)), \"x)\\\"y\"), Q", true);
+
+	check(properties.has_value() && properties->size() == 2u, "Typed: two properties are found");
+
+	if (properties.has_value() && properties->size() == 2u)
+	{
+		check(properties->front().arguments == std::vector<std::string>{ "\"a,b\"", "(1, (2, 3))", "\"x)\\\"y\"" }, "Typed: quotes and nested enclosers are not split");
+		check(properties->front().typedArguments.size() == 3u, "Typed: one typed argument per argument");
+		check((*properties)[1].name == "Q", "Typed: parsing resumes after the end encloser");
+	}
+
+	check(!parseClassProperties("KGC:P(\"a)", true).has_value(), "Typed: unterminated string literal is an error");
+	check(!parseClassProperties("KGC:P((a, b)", true).has_value(), "Typed: unbalanced nested encloser is an error");
+}
+
+static void testTypedArguments()
+{
+	PropertyArgument argument = parseTypedArgument("42");
+	check(argument.type == EPropertyArgumentType::Integer && argument.integerValue == 42, "Decimal integer");
+
+	argument = parseTypedArgument("-0x1F");
+	check(argument.type == EPropertyArgumentType::Integer && argument.integerValue == -31, "Negative hexadecimal integer");
+
+	argument = parseTypedArgument("0XfF");
+	check(argument.type == EPropertyArgumentType::Integer && argument.integerValue == 255, "Hexadecimal integer with mixed case");
+
+	argument = parseTypedArgument("-9223372036854775808");
+	check(argument.type == EPropertyArgumentType::Integer && argument.integerValue == INT64_MIN, "INT64_MIN");
+
+	argument = parseTypedArgument("9223372036854775807");
+	check(argument.type == EPropertyArgumentType::Integer && argument.integerValue == INT64_MAX, "INT64_MAX");
+
+	argument = parseTypedArgument("9223372036854775808");
+	check(argument.type != EPropertyArgumentType::Integer, "INT64_MAX + 1 is not an integer");
+
+	argument = parseTypedArgument("0x");
+	check(argument.type != EPropertyArgumentType::Integer, "Hexadecimal prefix without digits is not an integer");
+
+	argument = parseTypedArgument("1.5f");
+	check(argument.type == EPropertyArgumentType::FloatingPoint && argument.floatingPointValue == 1.5, "Floating point with f suffix");
+
+	argument = parseTypedArgument("-2.5e3");
+	check(argument.type == EPropertyArgumentType::FloatingPoint && argument.floatingPointValue == -2500.0, "Floating point with exponent");
+
+	argument = parseTypedArgument("true");
+	check(argument.type == EPropertyArgumentType::Boolean && argument.booleanValue, "Boolean true");
+
+	argument = parseTypedArgument("false");
+	check(argument.type == EPropertyArgumentType::Boolean && !argument.booleanValue, "Boolean false");
+
+	argument = parseTypedArgument("ns::Type_1");
+	check(argument.type == EPropertyArgumentType::Identifier && argument.stringValue == "ns::Type_1", "Qualified identifier");
+
+	argument = parseTypedArgument("\"a\\\"b\\\\c\\n\"");
+	check(argument.type == EPropertyArgumentType::String && argument.stringValue == "a\"b\\c\\n", "String literal escapes: only \\\" and \\\\ are resolved");
+
+	argument = parseTypedArgument("a b");
+	check(argument.type == EPropertyArgumentType::String && argument.stringValue == "a b", "Unquoted text falls back to a string");
+
+	argument = parseTypedArgument("(1, (true, \"x,y\"), 2.0)");
+	check(argument.type == EPropertyArgumentType::List && argument.listValue.size() == 3u, "List with a nested list");
+
+	if (argument.type == EPropertyArgumentType::List && argument.listValue.size() == 3u)
+	{
+		check(argument.listValue[0].type == EPropertyArgumentType::Integer && argument.listValue[0].integerValue == 1, "List element: integer");
+		check(argument.listValue[1].type == EPropertyArgumentType::List && argument.listValue[1].listValue.size() == 2u, "List element: nested list");
+		check(argument.listValue[1].listValue.size() == 2u && argument.listValue[1].listValue[1].stringValue == "x,y", "Nested list element: string containing a separator");
+		check(argument.listValue[2].type == EPropertyArgumentType::FloatingPoint, "List element: floating point");
+	}
+
+	argument = parseTypedArgument("()");
+	check(argument.type == EPropertyArgumentType::List && argument.listValue.empty(), "Empty list");
+
+	argument = parseTypedArgument("(a)(b)");
+	check(argument.type == EPropertyArgumentType::String && argument.stringValue == "(a)(b)" && argument.listValue.empty(), "Two adjacent groups are not a list");
+}
+
+int main()
+{
+	testUntypedTokenizer();
+	testTypedTokenizer();
+	testTypedArguments();
+
+	return getExitCode("All property parser tests passed.");
+}
@@ -0,0 +1,51 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <iostream>
+#include <cstdlib>	//EXIT_SUCCESS, EXIT_FAILURE
+
+namespace kodgen::tests
+{
+	/** Number of failed checks since the test executable started. */
+	inline int failureCount = 0;
+
+	/**
+	*	@brief Report a failed check on the error output if the condition is false.
+	*
+	*	@param condition	Condition which must be true for the check to pass.
+	*	@param description	Description of the check printed on failure.
+	*/
+	inline void check(bool condition, char const* description) noexcept
+	{
+		if (!condition)
+		{
+			std::cerr << "FAILED: " << description << std::endl;
+			failureCount++;
+		}
+	}
+
+	/**
+	*	@brief Compute the exit code of a test executable, and print a success message if all checks passed.
+	*
+	*	@param successMessage Message printed on the standard output if no check failed.
+	*
+	*	@return EXIT_FAILURE if a check failed, else EXIT_SUCCESS.
+	*/
+	inline int getExitCode(char const* successMessage) noexcept
+	{
+		if (failureCount != 0)
+		{
+			return EXIT_FAILURE;
+		}
+
+		std::cout << successMessage << std::endl;
+
+		return EXIT_SUCCESS;
+	}
+}
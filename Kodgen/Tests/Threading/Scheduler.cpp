@@ -0,0 +1,147 @@
+#include <atomic>
+#include <vector>
+
+#include <Kodgen/Threading/ThreadPool.h>
+#include <Kodgen/Threading/TaskHelper.h>
+
+#include "TestHelpers.h"
+
+using namespace kodgen;
+using namespace kodgen::tests;
+
+//A task only runs once all its dependencies completed, and can read their results
+static void testDependencies()
+{
+	ThreadPool			threadPool(4u);
+	std::atomic<int>	order{0};
+	int					aOrder = -1;
+	int					bOrder = -1;
+
+	auto a = threadPool.submitTask("A", [&](TaskBase*) -> int { aOrder = order++; return 20; });
+	auto b = threadPool.submitTask("B", [&](TaskBase*) -> int { bOrder = order++; return 22; });
+	auto c = threadPool.submitTask("C", [&](TaskBase* task) -> int
+								   {
+									   return TaskHelper::getDependencyResult<int>(task, 0u) + TaskHelper::getDependencyResult<int>(task, 1u);
+								   }, { a, b });
+
+	threadPool.waitFor(c);
+
+	check(aOrder >= 0 && bOrder >= 0, "Dependencies run before their continuation");
+	check(TaskHelper::getResult<int>(c.get()) == 42, "Continuation reads the results of its dependencies");
+}
+
+//A task depending on an already completed task is still executed
+static void testCompletedDependency()
+{
+	ThreadPool threadPool(2u);
+
+	auto a = threadPool.submitTask("A", [](TaskBase*) -> int { return 1; });
+
+	threadPool.waitFor(a);
+
+	auto b = threadPool.submitTask("B", [](TaskBase* task) -> int { return TaskHelper::getDependencyResult<int>(task, 0u) + 1; }, { a });
+
+	threadPool.waitFor(b);
+
+	check(TaskHelper::getResult<int>(b.get()) == 2, "Continuation of a completed task is executed");
+}
+
+//Long chains and wide fan-ins of continuations are all released, whatever the order dependencies complete
+static void testContinuations()
+{
+	constexpr int const chainLength	= 2000;
+	constexpr int const fanInWidth	= 500;
+
+	ThreadPool			threadPool(8u);
+	std::atomic<int>	executedCount{0};
+	std::atomic<int>	fanInExecutedCount{0};
+
+	std::shared_ptr<TaskBase> previous = threadPool.submitTask("Chain 0", [&](TaskBase*) -> int { executedCount++; return 0; });
+
+	for (int i = 1; i < chainLength; i++)
+	{
+		previous = threadPool.submitTask("Chain", [&](TaskBase* task) -> int
+										 {
+											 executedCount++;
+											 return TaskHelper::getDependencyResult<int>(task, 0u) + 1;
+										 }, { previous });
+	}
+
+	std::vector<std::shared_ptr<TaskBase>> fanIn;
+
+	for (int i = 0; i < fanInWidth; i++)
+	{
+		fanIn.push_back(threadPool.submitTask("Fan in", [&](TaskBase*) { executedCount++; fanInExecutedCount++; }));
+	}
+
+	//The chain runs concurrently with the fan-in, so the continuation can only rely on the fan-in tasks
+	auto last = threadPool.submitTask("Last", [&](TaskBase*) -> bool { return fanInExecutedCount.load() == fanInWidth; }, std::move(fanIn));
+
+	threadPool.waitFor(previous);
+	threadPool.waitFor(last);
+
+	check(TaskHelper::getResult<int>(previous.get()) == chainLength - 1, "Every task of a continuation chain is executed in order");
+	check(TaskHelper::getResult<bool>(last.get()), "A continuation runs after all its dependencies");
+
+	threadPool.joinWorkers();
+
+	check(executedCount.load() == chainLength + fanInWidth, "All tasks are executed once");
+}
+
+//A worker waiting for a task keeps executing other tasks instead of blocking the pool
+static void testNestedWaitFor()
+{
+	ThreadPool threadPool(2u);
+
+	auto outer = threadPool.submitTask("Outer", [&threadPool](TaskBase*) -> int
+									   {
+										   int sum = 0;
+
+										   for (int i = 0; i < 100; i++)
+										   {
+											   auto inner = threadPool.submitTask("Inner", [i](TaskBase*) -> int { return i; });
+
+											   threadPool.waitFor(inner);
+											   sum += TaskHelper::getResult<int>(inner.get());
+										   }
+
+										   return sum;
+									   });
+
+	threadPool.waitFor(outer);
+
+	check(TaskHelper::getResult<int>(outer.get()) == 4950, "waitFor from a worker executes the awaited tasks");
+}
+
+//Tasks pushed while the pool is paused are all executed once it runs again, and joinWorkers waits for them
+static void testJoinWorkers()
+{
+	ThreadPool			threadPool(4u);
+	std::atomic<int>	executedCount{0};
+
+	for (int pass = 0; pass < 20; pass++)
+	{
+		threadPool.setIsRunning(false);
+
+		for (int i = 0; i < 200; i++)
+		{
+			threadPool.submitTask("Task", [&](TaskBase*) { executedCount++; });
+		}
+
+		threadPool.setIsRunning(true);
+		threadPool.joinWorkers();
+
+		check(executedCount.load() == (pass + 1) * 200, "joinWorkers returns once all submitted tasks are executed");
+	}
+}
+
+int main()
+{
+	testDependencies();
+	testCompletedDependency();
+	testContinuations();
+	testNestedWaitFor();
+	testJoinWorkers();
+
+	return getExitCode("All scheduler tests passed.");
+}